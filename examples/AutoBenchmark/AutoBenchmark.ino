@@ -34,7 +34,7 @@ SOFTWARE.
  * sizeof(xxx): yy
  * ...
  * BENCHMARKS
- * {name} min avg max loopCount sampleSize
+ * {name} min avg max loopCount sampleSize p50 p95
  * ...
  * END
  *
@@ -44,7 +44,7 @@ SOFTWARE.
  */
 
 #include <Arduino.h>
-#include <AceCommon.h> // TimingStats
+#include <AceCommon.h> // TimingStats, TimingHistogram
 #include "Benchmark.h"
 
 using namespace ace_common;
@@ -56,6 +56,8 @@ using namespace ace_common;
 static void printSizeOf() {
   SERIAL_PORT_MONITOR.print(F("sizeof(TimingStats): "));
   SERIAL_PORT_MONITOR.println(sizeof(TimingStats));
+  SERIAL_PORT_MONITOR.print(F("sizeof(TimingHistogram<4, 24>): "));
+  SERIAL_PORT_MONITOR.println(sizeof(TimingHistogram<4, 24>));
 }
 
 //-----------------------------------------------------------------------------
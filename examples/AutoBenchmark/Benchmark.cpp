@@ -4,7 +4,7 @@
  */
 
 #include <Arduino.h> // F(), __FlashStringHelper
-#include <AceCommon.h> // printPad3To(), TimingStats
+#include <AceCommon.h>
 #include "Benchmark.h"
 
 #ifndef SERIAL_PORT_MONITOR
@@ -17,274 +17,399 @@ using namespace ace_common;
 // Benchmark configs
 //-----------------------------------------------------------------------------
 
-static const uint8_t SAMPLE_SIZE = 5;
-
-#if defined(ARDUINO_ARCH_AVR)
-  static const uint32_t LOOP_COUNT = 1UL*1000;
-#elif defined(ARDUINO_ARCH_SAMD)
-  static const uint32_t LOOP_COUNT = 5UL*1000;
-#elif defined(ARDUINO_ARCH_STM32)
-  static const uint32_t LOOP_COUNT = 10UL*1000;
-#elif defined(ESP8266)
-  static const uint32_t LOOP_COUNT = 10UL*1000;
-#elif defined(ESP32)
-  static const uint32_t LOOP_COUNT = 1UL*1000*1000;
-#elif defined(TEENSYDUINO)
-  static const uint32_t LOOP_COUNT = 1UL*1000*1000;
-#elif defined(EPOXY_DUINO)
-  static const uint32_t LOOP_COUNT = 1UL*1000*1000;
-#else
-  #error Unknown platform
-#endif
+static const uint8_t SAMPLE_SIZE = 20;
 
-//-----------------------------------------------------------------------------
-// Benchmark helpers
-//-----------------------------------------------------------------------------
+#if defined(AUTO_BENCHMARK_JSON)
 
 /**
- * Print micros per count as a floating point number with 3 decimal places.
- * For example, if `us=13032` and `count=2000`, this prints "6.516".
+ * Prints one JSON object per benchmark, in nanos per iteration, including the
+ * standard deviation of the samples. Used by 'make gate' to compare the
+ * results against the epoxy.json baseline.
  */
-void printMicros(uint32_t us, uint32_t count) {
-  uint32_t nanos = us * 1000 / count;
-  printUint32AsFloat3To(SERIAL_PORT_MONITOR, nanos);
-}
+typedef GenericStats<uint32_t, uint64_t, uint16_t, true> BenchmarkStats;
+static BenchmarkT<BenchmarkStats> benchmark(
+    SERIAL_PORT_MONITOR, BenchmarkT<BenchmarkStats>::kFormatJson);
+
+#else
 
 /**
- * Print the result in micros for the given 'name' function or algorithm. The
- * format is:
+ * Histogram of the elapsed nanos of each sample, up to about 16 millis, with
+ * a resolution of 1/16 (6.25%).
+ */
+typedef TimingHistogram<4, 24> BenchmarkStats;
+
+/**
+ * Prints one line per benchmark in the following format, in micros per
+ * iteration:
  *
  * @verbatim
- * name min avg max loopCount sampleSize
+ * name min avg max loopCount sampleSize p50 p95
  * @endverbatim
  *
- * @param name name of the benchmark
- * @param instance of TimingStats
- * @param loopCount number of inner loops which were used to build the
- *        timingStats
- * @param samplesize number of independent timingStats samples used, to get
- *        the min(), avg() and max()
+ * The loopCount is calibrated so that each sample takes about 5 millis. The
+ * p50 and p95 are appended after the original columns so that older result
+ * files can still be parsed by generate_table.awk.
  */
-static void printStats(
-    const __FlashStringHelper* name,
-    const TimingStats& stats,
-    uint32_t loopCount,
-    uint32_t sampleSize) {
-  SERIAL_PORT_MONITOR.print(name);
-  SERIAL_PORT_MONITOR.print(' ');
-  printMicros(stats.getMin(), loopCount);
-  SERIAL_PORT_MONITOR.print(' ');
-  printMicros(stats.getAvg(), loopCount);
-  SERIAL_PORT_MONITOR.print(' ');
-  printMicros(stats.getMax(), loopCount);
-  SERIAL_PORT_MONITOR.print(' ');
-  SERIAL_PORT_MONITOR.print(loopCount);
-  SERIAL_PORT_MONITOR.print(' ');
-  SERIAL_PORT_MONITOR.println(sampleSize);
-}
+static BenchmarkT<BenchmarkStats> benchmark(SERIAL_PORT_MONITOR);
 
-static TimingStats timingStats;
-
-// Volatile to prevent the compiler from deciding that the entire program does
-// nothing, causing it to opimize the whole program to nothing.
-volatile uint32_t disableCompilerOptimization;
+#endif
 
-// Typedef of the lambda expression that can be converted into a simple function
-// pointer.
-typedef void (*Lambda)();
+//-----------------------------------------------------------------------------
+// Benchmark inputs
+//-----------------------------------------------------------------------------
 
-/**
- * Return the number of micros ellapsed during the execution of the lambda. The
- * lambda function should contain a loop that runs the thing under test enough
- * times for this to return an ellapsed time in the range of roughly 1-20
- * micros. Shorter than that, we risk increasing the measurement error. Longer
- * than that, the ESP2866 may reboot due to the watchdog timer.
- *
- * The lambda should also write something to the `disableCompilerOptimization`
- * so that the compiler does optimize way the entire thing.
- *
- * In most cases, we should also run an empty-loop that does nothing but loop
- * for the same number of times, then update the `disableCompilerOptimization`,
- * and subtract its result from the previous result, to remove the overhead of
- * the loop construct itself. Sometime, when this is done, the number is
- * negative if the thing being tested run so quickly (compared to a single
- * iteration of the empty loop), that the measurement error is bigger than the
- * benchmark timing. The printStats() function needs to be able to handle that.
- */
-static uint32_t runLambda(Lambda lambda) {
-  yield();
-  uint32_t startMicros = micros();
-  lambda();
-  uint32_t elapsedMicros = micros() - startMicros;
-  yield();
-  return elapsedMicros;
+// The benchmarks run on 2 input sizes: SMALL_SIZE and LARGE_SIZE.
+static const uint8_t SMALL_SIZE = 8;
+static const uint8_t LARGE_SIZE = 64;
+
+// Inputs in RAM, initialized by initInputs(). The bodies call clobberMemory()
+// so that the compiler cannot hoist the function under test out of the loop.
+static char largeString[LARGE_SIZE + 1];
+static char largeString2[LARGE_SIZE + 1];
+static char largeBinaryString[LARGE_SIZE + 1];
+static uint16_t sortedList[LARGE_SIZE];
+
+// Points to the last SMALL_SIZE characters of the large strings.
+static const char* const smallString = largeString + LARGE_SIZE - SMALL_SIZE;
+static const char* const smallString2 = largeString2 + LARGE_SIZE - SMALL_SIZE;
+static const char* const smallBinaryString =
+    largeBinaryString + LARGE_SIZE - SMALL_SIZE;
+
+// Encoded forms of smallBinaryString and largeBinaryString, for hexDecode()
+// and base64Decode().
+static char smallHexString[SMALL_SIZE * 2 + 1];
+static char largeHexString[LARGE_SIZE * 2 + 1];
+static char smallBase64String[(SMALL_SIZE + 2) / 3 * 4 + 1];
+static char largeBase64String[(LARGE_SIZE + 2) / 3 * 4 + 1];
+
+// Output buffers
+static PrintStr<LARGE_SIZE + 8> printStr;
+static char outputBuf[LARGE_SIZE * 4 + 1];
+
+// Keywords of the KString, compressing "America/" and "Europe/".
+static const char* const KEYWORDS[] = {
+  nullptr,
+  "America/",
+  "Europe/",
+};
+static const uint8_t NUM_KEYWORDS = sizeof(KEYWORDS) / sizeof(KEYWORDS[0]);
+
+static void initInputs() {
+  for (uint8_t i = 0; i < LARGE_SIZE; i++) {
+    // Words of 7 letters separated by spaces, for copyReplaceString().
+    char c = ((i & 0x7) == 0x7) ? ' ' : 'a' + (i % 26);
+    largeString[i] = c;
+    largeString2[i] = c;
+    // One non-printable character in 8, for backslashXEncode().
+    largeBinaryString[i] = ((i & 0x7) == 0x7) ? 0x01 : c;
+    sortedList[i] = i * 3;
+  }
+  largeString[LARGE_SIZE] = '\0';
+  largeString2[LARGE_SIZE] = '\0';
+  largeBinaryString[LARGE_SIZE] = '\0';
+
+  hexEncode(smallHexString, sizeof(smallHexString),
+      (const uint8_t*) smallBinaryString, SMALL_SIZE, nullptr);
+  hexEncode(largeHexString, sizeof(largeHexString),
+      (const uint8_t*) largeBinaryString, LARGE_SIZE, nullptr);
+  base64Encode(smallBase64String, sizeof(smallBase64String),
+      (const uint8_t*) smallBinaryString, SMALL_SIZE, nullptr);
+  base64Encode(largeBase64String, sizeof(largeBase64String),
+      (const uint8_t*) largeBinaryString, LARGE_SIZE, nullptr);
 }
 
 //-----------------------------------------------------------------------------
 // Benchmarks
 //-----------------------------------------------------------------------------
 
-static void runUdiv1000Native() {
-  timingStats.reset();
-
-  for (uint8_t k = 0; k < SAMPLE_SIZE; k++) {
-
-    // We must count by 1100 because the compiler is too smart and optimizes
-    // away the loop if it knows that LOOP_COUNT is < 1000.
-    uint32_t rawMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT*1100; i+=1100) {
-        disableCompilerOptimization = (i+1) / 1000;
-      }
-    });
-
-    uint32_t emptyMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT*1100; i+=1100) {
-        disableCompilerOptimization = (i+1);
-      }
-    });
-
-    uint32_t benchmarkMicros = rawMicros - emptyMicros;
-    timingStats.update(benchmarkMicros);
-  }
-
-  printStats(F("/1000"), timingStats, LOOP_COUNT, SAMPLE_SIZE);
+// The baseline of each benchmark prepares the same argument as the body,
+// without calling the function under test.
+
+static void runArithmeticBenchmarks() {
+  benchmark.run(F("/1000"),
+      [](uint32_t i) { doNotOptimize((i + 1) / 1000); },
+      [](uint32_t i) { doNotOptimize(i + 1); });
+  benchmark.run(F("udiv1000()"),
+      [](uint32_t i) { doNotOptimize(udiv1000(i + 1)); },
+      [](uint32_t i) { doNotOptimize(i + 1); });
+  benchmark.run(F("decToBcdDivOnly()"),
+      [](uint32_t i) { doNotOptimize(decToBcdDivOnly(i & 0xFF)); },
+      [](uint32_t i) { doNotOptimize(i & 0xFF); });
+  benchmark.run(F("decToBcdDivMod()"),
+      [](uint32_t i) { doNotOptimize(decToBcdDivMod(i & 0xFF)); },
+      [](uint32_t i) { doNotOptimize(i & 0xFF); });
+  benchmark.run(F("decToBcd()"),
+      [](uint32_t i) { doNotOptimize(decToBcd(i & 0xFF)); },
+      [](uint32_t i) { doNotOptimize(i & 0xFF); });
+  benchmark.run(F("bcdToDec()"),
+      [](uint32_t i) { doNotOptimize(bcdToDec(i & 0xFF)); },
+      [](uint32_t i) { doNotOptimize(i & 0xFF); });
 }
 
-static void runUdiv1000() {
-  timingStats.reset();
-
-  for (uint8_t k = 0; k < SAMPLE_SIZE; k++) {
-
-    // We must count by 1100 because the compiler is too smart and optimizes
-    // away the loop if it knows that LOOP_COUNT is < 1000.
-    uint32_t rawMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT * 1100; i+=1100) {
-        disableCompilerOptimization = udiv1000(i+1);
-      }
-    });
-
-    uint32_t emptyMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT*1100; i+=1100) {
-        disableCompilerOptimization = i+1;
-      }
-    });
-
-    uint32_t benchmarkMicros = rawMicros - emptyMicros;
-    timingStats.update(benchmarkMicros);
-  }
-
-  printStats(F("udiv1000()"), timingStats, LOOP_COUNT, SAMPLE_SIZE);
+static void emptyPrintStr(uint32_t i) {
+  printStr.flush();
+  doNotOptimize(i);
 }
 
-static void runDecToBcdDivOnly() {
-  timingStats.reset();
-
-  for (uint8_t k = 0; k < SAMPLE_SIZE; k++) {
-
-    // We must count by 1100 because the compiler is too smart and optimizes
-    // away the loop if it knows that LOOP_COUNT is < 1000.
-    uint32_t rawMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = decToBcdDivOnly(i & 0xFF);
-      }
-    });
-
-    uint32_t emptyMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = i & 0xFF;
-      }
-    });
-
-    uint32_t benchmarkMicros = rawMicros - emptyMicros;
-    timingStats.update(benchmarkMicros);
-  }
-
-  printStats(F("decToBcdDivOnly()"), timingStats, LOOP_COUNT, SAMPLE_SIZE);
+static void runPrintStrBenchmarks() {
+  benchmark.run(F("PrintStr::write(c)/8"),
+      [](uint32_t /*i*/) {
+        printStr.flush();
+        for (uint8_t k = 0; k < SMALL_SIZE; k++) printStr.write(smallString[k]);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("PrintStr::write(c)/64"),
+      [](uint32_t /*i*/) {
+        printStr.flush();
+        for (uint8_t k = 0; k < LARGE_SIZE; k++) printStr.write(largeString[k]);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("PrintStr::write(buf)/8"),
+      [](uint32_t /*i*/) {
+        printStr.flush();
+        printStr.write((const uint8_t*) smallString, SMALL_SIZE);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("PrintStr::write(buf)/64"),
+      [](uint32_t /*i*/) {
+        printStr.flush();
+        printStr.write((const uint8_t*) largeString, LARGE_SIZE);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
 }
 
-static void runDecToBcdDivMod() {
-  timingStats.reset();
-
-  for (uint8_t k = 0; k < SAMPLE_SIZE; k++) {
-
-    // We must count by 1100 because the compiler is too smart and optimizes
-    // away the loop if it knows that LOOP_COUNT is < 1000.
-    uint32_t rawMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = decToBcdDivMod(i & 0xFF);
-      }
-    });
-
-    uint32_t emptyMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = i & 0xFF;
-      }
-    });
-
-    uint32_t benchmarkMicros = rawMicros - emptyMicros;
-    timingStats.update(benchmarkMicros);
-  }
-
-  printStats(F("decToBcdDivMod()"), timingStats, LOOP_COUNT, SAMPLE_SIZE);
+// The formatting functions come in pairs, a compact version followed by a
+// faster (or more precise) version, which MemoryBenchmark measures under the
+// same names.
+static void runPrintBenchmarks() {
+  benchmark.run(F("printPad5To()"),
+      [](uint32_t i) {
+        printStr.flush();
+        printPad5To(printStr, (uint16_t) i);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("printPadTo<5>()"),
+      [](uint32_t i) {
+        printStr.flush();
+        printPadTo<5>(printStr, (uint16_t) i);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("printUint32AsFloat3To()"),
+      [](uint32_t i) {
+        printStr.flush();
+        printUint32AsFloat3To(printStr, i);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("printFixedPointTo<3>()"),
+      [](uint32_t i) {
+        printStr.flush();
+        printFixedPointTo<3>(printStr, i);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("Print::print(double)"),
+      [](uint32_t i) {
+        printStr.flush();
+        printStr.print((double) (uint16_t) i / 3, 6);
+        doNotOptimize(printStr.length());
+      },
+      [](uint32_t i) {
+        printStr.flush();
+        doNotOptimize((double) (uint16_t) i / 3);
+      });
+  benchmark.run(F("printFloatTo(float)"),
+      [](uint32_t i) {
+        printStr.flush();
+        printFloatTo(printStr, (float) (uint16_t) i / 3);
+        doNotOptimize(printStr.length());
+      },
+      [](uint32_t i) {
+        printStr.flush();
+        doNotOptimize((float) (uint16_t) i / 3);
+      });
+  benchmark.run(F("printfTo()"),
+      [](uint32_t i) {
+        printStr.flush();
+        printfTo(printStr, "%s=%d", smallString, (int) (uint8_t) i);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("printFormatTo()"),
+      [](uint32_t i) {
+        printStr.flush();
+        printFormatTo(printStr, "%s=%d", smallString, (int) (uint8_t) i);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
 }
 
-static void runDecToBcd() {
-  timingStats.reset();
-
-  for (uint8_t k = 0; k < SAMPLE_SIZE; k++) {
-
-    // We must count by 1100 because the compiler is too smart and optimizes
-    // away the loop if it knows that LOOP_COUNT is < 1000.
-    uint32_t rawMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = decToBcd(i & 0xFF);
-      }
-    });
-
-    uint32_t emptyMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = i & 0xFF;
-      }
-    });
-
-    uint32_t benchmarkMicros = rawMicros - emptyMicros;
-    timingStats.update(benchmarkMicros);
-  }
-
-  printStats(F("decToBcd()"), timingStats, LOOP_COUNT, SAMPLE_SIZE);
+static void runStringBenchmarks() {
+  benchmark.run(F("KString::compareTo()"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        KString ks("\x01Los_Angeles", KEYWORDS, NUM_KEYWORDS);
+        doNotOptimize(ks.compareTo("America/Los_Angeles"));
+      });
+  benchmark.run(F("KString::printTo()"),
+      [](uint32_t /*i*/) {
+        printStr.flush();
+        KString ks("\x01Los_Angeles", KEYWORDS, NUM_KEYWORDS);
+        ks.printTo(printStr);
+        doNotOptimize(printStr.length());
+      },
+      emptyPrintStr);
+  benchmark.run(F("FCString::compareTo()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(
+            FCString(smallString).compareTo(FCString(smallString2)));
+      });
+  benchmark.run(F("FCString::compareTo()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(
+            FCString(largeString).compareTo(FCString(largeString2)));
+      });
+  benchmark.run(F("copyReplaceString()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(copyReplaceString(
+            outputBuf, sizeof(outputBuf), smallString, ' ', "%20"));
+      });
+  benchmark.run(F("copyReplaceString()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(copyReplaceString(
+            outputBuf, sizeof(outputBuf), largeString, ' ', "%20"));
+      });
 }
 
-static void runBcdToDec() {
-  timingStats.reset();
-
-  for (uint8_t k = 0; k < SAMPLE_SIZE; k++) {
-
-    // We must count by 1100 because the compiler is too smart and optimizes
-    // away the loop if it knows that LOOP_COUNT is < 1000.
-    uint32_t rawMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = bcdToDec(i & 0xFF);
-      }
-    });
-
-    uint32_t emptyMicros = runLambda([]() {
-      for (uint32_t i = 0; i < LOOP_COUNT; i++) {
-        disableCompilerOptimization = i & 0xFF;
-      }
-    });
+static void runHashBenchmarks() {
+  benchmark.run(F("hashDjb2()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(hashDjb2(smallString));
+      });
+  benchmark.run(F("hashDjb2()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(hashDjb2(largeString));
+      });
+}
 
-    uint32_t benchmarkMicros = rawMicros - emptyMicros;
-    timingStats.update(benchmarkMicros);
-  }
+static void runEncodingBenchmarks() {
+  benchmark.run(F("backslashXEncode()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(backslashXEncode(
+            outputBuf, sizeof(outputBuf), smallBinaryString, nullptr));
+      });
+  benchmark.run(F("backslashXEncode()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(backslashXEncode(
+            outputBuf, sizeof(outputBuf), largeBinaryString, nullptr));
+      });
+  benchmark.run(F("hexEncode()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(hexEncode(outputBuf, sizeof(outputBuf),
+            (const uint8_t*) smallBinaryString, SMALL_SIZE, nullptr));
+      });
+  benchmark.run(F("hexEncode()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(hexEncode(outputBuf, sizeof(outputBuf),
+            (const uint8_t*) largeBinaryString, LARGE_SIZE, nullptr));
+      });
+  benchmark.run(F("hexDecode()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(hexDecode((uint8_t*) outputBuf, sizeof(outputBuf),
+            smallHexString, nullptr));
+      });
+  benchmark.run(F("hexDecode()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(hexDecode((uint8_t*) outputBuf, sizeof(outputBuf),
+            largeHexString, nullptr));
+      });
+  benchmark.run(F("base64Encode()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(base64Encode(outputBuf, sizeof(outputBuf),
+            (const uint8_t*) smallBinaryString, SMALL_SIZE, nullptr));
+      });
+  benchmark.run(F("base64Encode()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(base64Encode(outputBuf, sizeof(outputBuf),
+            (const uint8_t*) largeBinaryString, LARGE_SIZE, nullptr));
+      });
+  benchmark.run(F("base64Decode()/8"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(base64Decode((uint8_t*) outputBuf, sizeof(outputBuf),
+            smallBase64String, nullptr));
+      });
+  benchmark.run(F("base64Decode()/64"),
+      [](uint32_t /*i*/) {
+        clobberMemory();
+        doNotOptimize(base64Decode((uint8_t*) outputBuf, sizeof(outputBuf),
+            largeBase64String, nullptr));
+      });
+}
 
-  printStats(F("bcdToDec()"), timingStats, LOOP_COUNT, SAMPLE_SIZE);
+static void runSearchBenchmarks() {
+  // Search each element in turn, using the baseline to remove the cost of
+  // selecting the element.
+  benchmark.run(F("linearSearch()/8"),
+      [](uint32_t i) {
+        clobberMemory();
+        doNotOptimize(linearSearch(
+            sortedList, SMALL_SIZE, sortedList[i % SMALL_SIZE]));
+      },
+      [](uint32_t i) { doNotOptimize(sortedList[i % SMALL_SIZE]); });
+  benchmark.run(F("linearSearch()/64"),
+      [](uint32_t i) {
+        clobberMemory();
+        doNotOptimize(linearSearch(
+            sortedList, LARGE_SIZE, sortedList[i % LARGE_SIZE]));
+      },
+      [](uint32_t i) { doNotOptimize(sortedList[i % LARGE_SIZE]); });
+  benchmark.run(F("binarySearch()/8"),
+      [](uint32_t i) {
+        clobberMemory();
+        doNotOptimize(binarySearch(
+            sortedList, SMALL_SIZE, sortedList[i % SMALL_SIZE]));
+      },
+      [](uint32_t i) { doNotOptimize(sortedList[i % SMALL_SIZE]); });
+  benchmark.run(F("binarySearch()/64"),
+      [](uint32_t i) {
+        clobberMemory();
+        doNotOptimize(binarySearch(
+            sortedList, LARGE_SIZE, sortedList[i % LARGE_SIZE]));
+      },
+      [](uint32_t i) { doNotOptimize(sortedList[i % LARGE_SIZE]); });
 }
 
 void runBenchmarks() {
-  runUdiv1000Native();
-  runUdiv1000();
-  runDecToBcdDivOnly();
-  runDecToBcdDivMod();
-  runDecToBcd();
-  runBcdToDec();
+  CycleClock::begin();
+  initInputs();
+  benchmark.setSamples(SAMPLE_SIZE);
+
+  runArithmeticBenchmarks();
+  runPrintStrBenchmarks();
+  runPrintBenchmarks();
+  runStringBenchmarks();
+  runHashBenchmarks();
+  runEncodingBenchmarks();
+  runSearchBenchmarks();
 }
@@ -1,5 +1,5 @@
-#ifndef ACE_COMMON_BENCHMARK_H
-#define ACE_COMMON_BENCHMARK_H
+#ifndef AUTO_BENCHMARK_BENCHMARK_H
+#define AUTO_BENCHMARK_BENCHMARK_H
 
 extern void runBenchmarks();
 
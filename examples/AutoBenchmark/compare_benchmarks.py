@@ -0,0 +1,101 @@
+#!/usr/bin/python3
+#
+# Compare the JSON Lines output of AutoBenchmark (compiled with
+# -DAUTO_BENCHMARK_JSON) against a baseline file, and exit with status 1 if a
+# benchmark is slower than the baseline by more than the noise threshold, or
+# if a benchmark of the baseline is missing.
+#
+# The threshold of each benchmark is the largest of:
+#
+#   * SIGMA times the combined standard deviation of the samples of the
+#     baseline and the current run (the 'stdDevNanos' calculated by
+#     GenericStats),
+#   * TOLERANCE times the average of the baseline,
+#   * FLOOR nanoseconds, for the functions that take less than 1 nanosecond.
+#
+# Usage: compare_benchmarks.py [--sigma 3] [--tolerance 0.20] [--floor 1.0]
+#        baseline.json current.json
+
+import argparse
+import json
+import math
+import sys
+
+
+def read_results(path):
+    """Read the JSON objects of the file, skipping the other lines printed by
+    AutoBenchmark (SIZEOF, BENCHMARKS, END). Return a dict of name to object,
+    and the names in the order of the file."""
+    results = {}
+    names = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith('{'):
+                continue
+            result = json.loads(line)
+            results[result['name']] = result
+            names.append(result['name'])
+    return results, names
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare AutoBenchmark results against a baseline')
+    parser.add_argument('--sigma', type=float, default=3.0,
+                        help='Number of standard deviations (default 3)')
+    parser.add_argument('--tolerance', type=float, default=0.20,
+                        help='Fraction of the baseline average (default 0.20)')
+    parser.add_argument('--floor', type=float, default=1.0,
+                        help='Minimum threshold in nanos (default 1.0)')
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    args = parser.parse_args()
+
+    baseline, names = read_results(args.baseline)
+    current, current_names = read_results(args.current)
+
+    print('%-26s %12s %12s %8s %10s  %s' % (
+        'name', 'base(ns)', 'current(ns)', 'change', 'threshold', 'status'))
+    failures = 0
+    for name in names:
+        base = baseline[name]
+        if name not in current:
+            print('%-26s %12.3f %12s %8s %10s  %s' % (
+                name, base['avgNanos'], '-', '-', '-', 'MISSING'))
+            failures += 1
+            continue
+
+        cur = current[name]
+        base_avg = base['avgNanos']
+        cur_avg = cur['avgNanos']
+        noise = math.hypot(
+            base.get('stdDevNanos', 0.0), cur.get('stdDevNanos', 0.0))
+        threshold = max(
+            args.sigma * noise, args.tolerance * base_avg, args.floor)
+        delta = cur_avg - base_avg
+        if delta > threshold:
+            status = 'REGRESSION'
+            failures += 1
+        elif -delta > threshold:
+            status = 'faster'
+        else:
+            status = 'ok'
+        change = ('%+7.1f%%' % (100.0 * delta / base_avg)) \
+            if base_avg > 0 else '-'
+        print('%-26s %12.3f %12.3f %8s %10.3f  %s' % (
+            name, base_avg, cur_avg, change, threshold, status))
+
+    for name in current_names:
+        if name not in baseline:
+            print('%-26s %12s %12.3f %8s %10s  %s' % (
+                name, '-', current[name]['avgNanos'], '-', '-', 'new'))
+
+    if failures > 0:
+        print('FAILED: %d benchmark(s) regressed or missing' % failures)
+        sys.exit(1)
+    print('PASSED')
+
+
+if __name__ == '__main__':
+    main()
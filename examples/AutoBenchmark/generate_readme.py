@@ -71,7 +71,49 @@ $ make README.md
 ```
 
 The CPU times below are given in microseconds. The "samples" column is the
-number of `TimingStats::update()` calls that were made.
+number of `TimingHistogram::update()` calls that were made. The p50 and p95
+columns are the median and the 95th percentile of those samples, with a
+resolution of 1/16 (6.25%). They show "-" for results collected before the
+percentiles were added. Each sample is timed with the `CycleClock`, which
+counts CPU cycles on the ARM Cortex-M3/M4/M7 and ESP processors, instead of
+`micros()`. The AVR and SAMD21 processors still use `micros()`.
+
+The benchmarks are run by the `BenchmarkT` class in
+[src/benchmark](../../src/benchmark), which calibrates the `loopCnt` so that
+each sample takes about 5 milliseconds. Results collected before that used a
+fixed `loopCnt` for each processor.
+
+The benchmarks cover the `arithmetic.h` functions, `PrintStr`, the print
+functions, `KString`, `FCString`, `copyReplaceString()`, `hashDjb2()`,
+`backslashXEncode()`, the hex and Base64 codecs, `linearSearch()` and
+`binarySearch()`. A `/8` or `/64` suffix gives the size of the input string or
+list. The functions added after v1.6.0 are missing from the older results. The
+alternative implementations of the same function (e.g. `printPad5To()` and
+`printPadTo<5>()`) use the same names as the features of
+[MemoryBenchmark](../MemoryBenchmark), which can print a speed versus size
+table for each board.
+
+### Regression Gate
+
+The `make gate` target runs the benchmarks under
+[EpoxyDuino](https://github.com/bxparks/EpoxyDuino) on the host machine, with
+the `AUTO_BENCHMARK_JSON` macro defined so that the results are printed in JSON
+format with a standard deviation for each benchmark. The `compare_benchmarks.py`
+script compares those results against the baseline in `epoxy.json`, and fails
+if the average time of any benchmark got slower by more than the largest of
+3 standard deviations, 20% of the baseline, or 1 nanosecond:
+
+```
+$ make gate
+```
+
+The baseline depends on the host machine, so it is not checked into the
+repository. It must be recorded on the machine that runs the gate, before the
+first `make gate` (which fails if `epoxy.json` is missing), using:
+
+```
+$ make gate_baseline
+```
 
 ## CPU Time Changes
 
@@ -40,6 +40,9 @@ BEGIN {
     u[benchmark_index]["max"] = $4
     u[benchmark_index]["loopCount"] = $5
     u[benchmark_index]["sampleSize"] = $6
+    # The percentiles are missing in older result files.
+    u[benchmark_index]["p50"] = (NF >= 8) ? sprintf("%7.3f", $7) : "      -"
+    u[benchmark_index]["p95"] = (NF >= 8) ? sprintf("%7.3f", $8) : "      -"
     benchmark_index++
   }
 }
@@ -57,12 +60,13 @@ END {
   print ""
   print "CPU:"
 
-  printf("+---------------------------+-------------------------+---------+\n")
-  printf("| AceCommon function        |     min/    avg/    max | loopCnt |\n")
-  printf("|---------------------------+-------------------------+---------|\n")
+  printf("+---------------------------+-------------------------+-----------------+---------+\n")
+  printf("| AceCommon function        |     min/    avg/    max |     p50/    p95 | loopCnt |\n")
+  printf("|---------------------------+-------------------------+-----------------+---------|\n")
   for (i = 0; i < TOTAL_BENCHMARKS; i++) {
-    printf("| %-25s | %7.3f/%7.3f/%7.3f | %7d |\n",
-      u[i]["name"], u[i]["min"], u[i]["avg"], u[i]["max"], u[i]["loopCount"])
+    printf("| %-25s | %7.3f/%7.3f/%7.3f | %s/%s | %7d |\n",
+      u[i]["name"], u[i]["min"], u[i]["avg"], u[i]["max"],
+      u[i]["p50"], u[i]["p95"], u[i]["loopCount"])
   }
-  printf("+---------------------------+-------------------------+---------+\n")
+  printf("+---------------------------+-------------------------+-----------------+---------+\n")
 }
@@ -0,0 +1,243 @@
+#include <Arduino.h>
+#include <AceCommon.h>
+#include "base64_naive.hpp"
+
+using namespace ace_common;
+
+const int NUM_SAMPLES = 20;
+
+#if defined(__linux__) || defined(__APPLE__)
+  const unsigned BASE64_SIZES[] = {1000, 2000, 4000, 8000};
+#elif defined(ESP8266)
+  const unsigned BASE64_SIZES[] = {1000, 2000, 4000, 8000};
+#elif defined(ESP32)
+  #ifndef SERIAL_PORT_MONITOR
+    #define SERIAL_PORT_MONITOR Serial
+  #endif
+  const unsigned BASE64_SIZES[] = {1000, 2000, 4000, 8000};
+#elif defined(ARDUINO_ARCH_AVR)
+  const unsigned BASE64_SIZES[] = {24, 48, 96};
+#else
+  const unsigned BASE64_SIZES[] = {100, 200, 400, 800};
+#endif
+
+const unsigned NUM_SIZES = sizeof(BASE64_SIZES) / sizeof(BASE64_SIZES[0]);
+
+// A volatile variable that's updated at the end of the benchmark routine
+// to prevent the compiler from optimizing away the entire calculation because
+// it determines that there is no side-effect.
+volatile uint8_t guard;
+
+/** Create a random binary message of length size. */
+void createMessage(uint8_t* message, uint16_t size) {
+  for (uint16_t i = 0; i < size; i++) {
+    message[i] = random(256);
+  }
+}
+
+/** Return the size of the Base64 encoding of size bytes, including the NUL. */
+uint16_t encodedSize(uint16_t size) {
+  return (size + 2) / 3 * 4 + 1;
+}
+
+/** Print one row of the results table. */
+void printRow(const char* label, uint16_t size, const TimingStats& stats) {
+  uint16_t perMil = (stats.getAvg() * 1000L) / size;
+
+#if defined(ESP32) || defined(ESP8266)
+  SERIAL_PORT_MONITOR.printf(
+      "%-19s(%4u) | %6u | %6u | %6u | %6u |\n",
+      label, size, stats.getAvg(), perMil, stats.getMin(), stats.getMax());
+#else
+  printfTo(SERIAL_PORT_MONITOR,
+      "%-19s(%4u) | %6u | %6u | %6u | %6u |\n",
+      label, size, stats.getAvg(), perMil, stats.getMin(), stats.getMax());
+#endif
+}
+
+//----------------------------------------------------------------------------
+// base64Encode()
+//----------------------------------------------------------------------------
+
+void printBase64EncodeTime(uint16_t size) {
+  uint8_t* message = new uint8_t[size];
+  createMessage(message, size);
+  uint16_t tcap = encodedSize(size);
+  char* encoded = new char[tcap];
+  yield();
+
+  TimingStats stats;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    uint16_t nowMicros = micros();
+    base64Encode(encoded, tcap, message, size, nullptr);
+    uint16_t elapsed = micros() - nowMicros;
+
+    yield();
+    guard = encoded[0];
+    stats.update(elapsed);
+  }
+  printRow("base64Encode", size, stats);
+
+  delete[] encoded;
+  delete[] message;
+}
+
+//----------------------------------------------------------------------------
+// base64Decode()
+//----------------------------------------------------------------------------
+
+void printBase64DecodeTime(uint16_t size) {
+  uint8_t* message = new uint8_t[size];
+  createMessage(message, size);
+  uint16_t tcap = encodedSize(size);
+  char* encoded = new char[tcap];
+  base64Encode(encoded, tcap, message, size, nullptr);
+  yield();
+
+  TimingStats stats;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    uint16_t nowMicros = micros();
+    base64Decode(message, size, encoded, nullptr);
+    uint16_t elapsed = micros() - nowMicros;
+
+    yield();
+    guard = message[0];
+    stats.update(elapsed);
+  }
+  printRow("base64Decode", size, stats);
+
+  delete[] encoded;
+  delete[] message;
+}
+
+//----------------------------------------------------------------------------
+// printBase64To()
+//----------------------------------------------------------------------------
+
+void printPrintBase64ToTime(uint16_t size) {
+  uint8_t* message = new uint8_t[size];
+  createMessage(message, size);
+  PrintStrN printString(encodedSize(size));
+  yield();
+
+  TimingStats stats;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    printString.flush();
+    uint16_t nowMicros = micros();
+    printBase64To(printString, message, size);
+    uint16_t elapsed = micros() - nowMicros;
+
+    yield();
+    guard = printString.length();
+    stats.update(elapsed);
+  }
+  printRow("printBase64To", size, stats);
+
+  delete[] message;
+}
+
+//----------------------------------------------------------------------------
+// base64_naive_encode()
+//----------------------------------------------------------------------------
+
+void printNaiveEncodeTime(uint16_t size) {
+  uint8_t* message = new uint8_t[size];
+  createMessage(message, size);
+  yield();
+
+  TimingStats stats;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    uint16_t nowMicros = micros();
+    String encoded = base64_naive_encode(message, size);
+    uint16_t elapsed = micros() - nowMicros;
+
+    yield();
+    guard = encoded.length();
+    stats.update(elapsed);
+  }
+  printRow("base64_naive_encode", size, stats);
+
+  delete[] message;
+}
+
+//----------------------------------------------------------------------------
+// base64_naive_decode()
+//----------------------------------------------------------------------------
+
+void printNaiveDecodeTime(uint16_t size) {
+  uint8_t* message = new uint8_t[size];
+  createMessage(message, size);
+  String encoded = base64_naive_encode(message, size);
+  delete[] message;
+  yield();
+
+  TimingStats stats;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    uint16_t nowMicros = micros();
+    String decoded = base64_naive_decode(encoded);
+    uint16_t elapsed = micros() - nowMicros;
+
+    yield();
+    guard = decoded.length();
+    stats.update(elapsed);
+  }
+  printRow("base64_naive_decode", size, stats);
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void printDivider() {
+  SERIAL_PORT_MONITOR.println(
+      F("--------------------------+--------+--------+--------+--------+"));
+}
+
+void setup() {
+#if ! defined(EPOXY_DUINO)
+  delay(1000);
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while (!SERIAL_PORT_MONITOR); // Wait until ready - Leonardo/Micro
+
+  printDivider();
+  SERIAL_PORT_MONITOR.println(
+      F("Description               | micros | us/1000|    min |    max |"));
+
+  printDivider();
+  for (unsigned i = 0; i < NUM_SIZES; i++) {
+    printBase64EncodeTime(BASE64_SIZES[i]);
+  }
+
+  printDivider();
+  for (unsigned i = 0; i < NUM_SIZES; i++) {
+    printBase64DecodeTime(BASE64_SIZES[i]);
+  }
+
+  printDivider();
+  for (unsigned i = 0; i < NUM_SIZES; i++) {
+    printPrintBase64ToTime(BASE64_SIZES[i]);
+  }
+
+  printDivider();
+  for (unsigned i = 0; i < NUM_SIZES; i++) {
+    printNaiveEncodeTime(BASE64_SIZES[i]);
+  }
+
+  printDivider();
+  for (unsigned i = 0; i < NUM_SIZES; i++) {
+    printNaiveDecodeTime(BASE64_SIZES[i]);
+  }
+
+  printDivider();
+  SERIAL_PORT_MONITOR.print(F("Num iterations: "));
+  SERIAL_PORT_MONITOR.println(NUM_SAMPLES);
+
+#if defined(EPOXY_DUINO)
+  exit(0);
+#endif
+}
+
+void loop() {
+}
@@ -0,0 +1,46 @@
+#include <string.h>
+#include "base64_naive.hpp"
+
+static const char ALPHABET[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+String base64_naive_encode(const uint8_t* data, size_t n) {
+  String encoded;
+  size_t i = 0;
+  while (i + 2 < n) {
+    uint32_t v = ((uint32_t) data[i] << 16) | (data[i+1] << 8) | data[i+2];
+    encoded += ALPHABET[(v >> 18) & 0x3F];
+    encoded += ALPHABET[(v >> 12) & 0x3F];
+    encoded += ALPHABET[(v >> 6) & 0x3F];
+    encoded += ALPHABET[v & 0x3F];
+    i += 3;
+  }
+  if (i < n) {
+    uint32_t v = (uint32_t) data[i] << 16;
+    if (i + 1 < n) v |= data[i+1] << 8;
+    encoded += ALPHABET[(v >> 18) & 0x3F];
+    encoded += ALPHABET[(v >> 12) & 0x3F];
+    encoded += (i + 1 < n) ? ALPHABET[(v >> 6) & 0x3F] : '=';
+    encoded += '=';
+  }
+  return encoded;
+}
+
+String base64_naive_decode(const String& encoded) {
+  String decoded;
+  uint32_t acc = 0;
+  int bits = 0;
+  for (unsigned i = 0; i < encoded.length(); i++) {
+    char c = encoded[i];
+    if (c == '=') break;
+    const char* p = strchr(ALPHABET, c);
+    if (p == nullptr) break;
+    acc = (acc << 6) | (p - ALPHABET);
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      decoded += (char) ((acc >> bits) & 0xFF);
+    }
+  }
+  return decoded;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+A straightforward Base64 encoder and decoder, written in the style commonly
+found in Arduino sketches and libraries: the output is accumulated in a
+String one character at a time, and each encoded character is decoded by
+searching for it in the alphabet.
+
+Used only as the point of comparison for the base64_encoding.h routines in
+AceCommon.
+*/
+
+#include <Arduino.h>
+
+String base64_naive_encode(const uint8_t* data, size_t n);
+String base64_naive_decode(const String& encoded);
@@ -30,6 +30,16 @@ using namespace ace_common;
 #define FEATURE_KSTRING_COMPARE_TO_KSTRING 19
 #define FEATURE_BACKSLASH_X_ENCODE 20
 #define FEATURE_BACKSLASH_X_DECODE 21
+#define FEATURE_PRINTF_TO 22
+#define FEATURE_PRINT_FORMAT_TO 23
+#define FEATURE_PRINT_PAD_TO_5 24
+#define FEATURE_PRINT_FIXED_POINT_TO_3 25
+#define FEATURE_PRINT_DOUBLE 26
+#define FEATURE_PRINT_FLOAT_TO 27
+#define FEATURE_HEX_ENCODE 28
+#define FEATURE_HEX_DECODE 29
+#define FEATURE_BASE64_ENCODE 30
+#define FEATURE_BASE64_DECODE 31
 
 // Select one of the FEATURE_* parameter and compile. Then look at the flash
 // and RAM usage, compared to FEATURE_BASELINE usage to determine how much
@@ -171,6 +181,52 @@ void setup() {
   (void) status;
   guard = array[2];
 
+#elif FEATURE == FEATURE_PRINTF_TO
+  printfTo(SERIAL_PORT_MONITOR, "%s=%d", DECODED_STRING, guard);
+
+#elif FEATURE == FEATURE_PRINT_FORMAT_TO
+  printFormatTo(SERIAL_PORT_MONITOR, "%s=%d", DECODED_STRING, guard);
+
+#elif FEATURE == FEATURE_PRINT_PAD_TO_5
+  printPadTo<5>(SERIAL_PORT_MONITOR, (uint16_t) 1);
+
+#elif FEATURE == FEATURE_PRINT_FIXED_POINT_TO_3
+  printFixedPointTo<3>(SERIAL_PORT_MONITOR, (uint32_t) 123456UL);
+
+#elif FEATURE == FEATURE_PRINT_DOUBLE
+  SERIAL_PORT_MONITOR.print((double) guard / 3, 6);
+
+#elif FEATURE == FEATURE_PRINT_FLOAT_TO
+  printFloatTo(SERIAL_PORT_MONITOR, (float) guard / 3);
+
+#elif FEATURE == FEATURE_HEX_ENCODE
+  size_t written;
+  uint8_t status = hexEncode(
+      (char*) array, sizeof(array), (const uint8_t*) DECODED_STRING,
+      sizeof(DECODED_STRING) - 1, &written);
+  (void) status;
+  guard = array[2];
+
+#elif FEATURE == FEATURE_HEX_DECODE
+  size_t written;
+  uint8_t status = hexDecode(array, sizeof(array), "0D09615C", &written);
+  (void) status;
+  guard = array[2];
+
+#elif FEATURE == FEATURE_BASE64_ENCODE
+  size_t written;
+  uint8_t status = base64Encode(
+      (char*) array, sizeof(array), (const uint8_t*) DECODED_STRING,
+      sizeof(DECODED_STRING) - 1, &written);
+  (void) status;
+  guard = array[2];
+
+#elif FEATURE == FEATURE_BASE64_DECODE
+  size_t written;
+  uint8_t status = base64Decode(array, sizeof(array), "DQlhXA==", &written);
+  (void) status;
+  guard = array[2];
+
 #else
   #error Unknown FEATURE
 #endif
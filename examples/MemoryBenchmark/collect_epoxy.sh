@@ -0,0 +1,79 @@
+#!/bin/bash
+#
+# Compile each FEATURE from 0 to NUM_FEATURES on a Linux/MacOS host machine
+# using EpoxyDuino, and collect the flash and static RAM usage from the 'size'
+# command, for the regression gate ('make gate'). The flash is the text plus
+# the data segments, and the RAM is the data plus the bss segments.
+#
+# Usage: collect_epoxy.sh {result_file}
+#
+# Creates a {result_file} in the same format as collect.sh, with the max_flash
+# and max_ram set to 0:
+#
+#  FEATURE flash max_flash ram max_ram
+#  0  aa 0 cc 0
+#  ...
+
+set -eu
+
+PROGRAM_NAME='MemoryBenchmark.ino'
+BINARY_NAME='MemoryBenchmark.out'
+NUM_FEATURES=31  # excluding FEATURE_BASELINE
+temp_out_file=
+
+# Optimize for size, and remove the unused functions of the library, so that
+# only the code pulled in by each FEATURE is counted. The flags are also passed
+# to the linker by EpoxyDuino.
+if [[ $(uname) == 'Darwin' ]]; then
+    SIZE_FLAGS='-Os -ffunction-sections -fdata-sections -Wl,-dead_strip'
+else
+    SIZE_FLAGS='-Os -ffunction-sections -fdata-sections -Wl,--gc-sections'
+fi
+
+function usage() {
+    echo 'Usage: collect_epoxy.sh {result_file}'
+    exit 1
+}
+
+function cleanup() {
+    if [[ "$temp_out_file" != '' ]]; then
+        rm -f $temp_out_file
+    fi
+    sed -i -e "s/#define FEATURE [0-9]*/#define FEATURE 0/" $PROGRAM_NAME
+    make clean > /dev/null
+}
+
+function create_temp_file() {
+    temp_out_file=$(mktemp /tmp/memory_benchmark.epoxy.XXXXXX)
+}
+
+function collect() {
+    local result_file=$1
+
+    for feature in $(seq 0 $NUM_FEATURES); do
+        echo "Collecting flash and ram usage for FEATURE $feature"
+        sed -i -e "s/#define FEATURE [0-9]*/#define FEATURE $feature/" \
+            $PROGRAM_NAME
+
+        # Run make, redirecting output to temp file. If error, print the output.
+        if ! make EXTRA_CXXFLAGS="$SIZE_FLAGS" 2>&1 > $temp_out_file; then
+            cat $temp_out_file
+            exit 1
+        fi
+
+        size $BINARY_NAME | tail -1 | \
+            awk -v feature=$feature \
+                '{print feature, $1 + $2, 0, $2 + $3, 0}' >> $result_file
+    done
+}
+
+trap "cleanup" EXIT
+
+if [[ $# < 1 ]]; then
+    usage
+fi
+
+rm -f $1
+create_temp_file
+make clean > /dev/null
+collect $1
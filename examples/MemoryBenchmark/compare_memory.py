@@ -0,0 +1,135 @@
+#!/usr/bin/python3
+#
+# Compare the flash and static RAM usage collected by collect_epoxy.sh (or
+# collect.sh) against a baseline file, and exit with status 1 if a FEATURE
+# uses more memory than the baseline by more than a threshold. The comparison
+# uses the increase over FEATURE_BASELINE (the "delta" column of the README
+# tables), so that the size of the Arduino core does not matter.
+#
+# The threshold is the larger of the given number of bytes, and the given
+# fraction of the delta of the baseline.
+#
+# Usage: compare_memory.py [--flash-bytes 32] [--ram-bytes 8]
+#        [--tolerance 0.05] baseline.txt current.txt
+
+import argparse
+import re
+import sys
+
+
+def read_labels(path):
+    """Return a dict of FEATURE number to name, from the '#define FEATURE_XXX
+    n' lines of MemoryBenchmark.ino."""
+    labels = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'#define FEATURE_(\w+) (\d+)', line)
+            if m:
+                labels[int(m.group(2))] = m.group(1)
+    return labels
+
+
+def read_results(path):
+    """Return a dict of FEATURE number to (flash, ram) from the result file.
+    An overflow is recorded as (-1, -1). The ram is -1 for boards which do
+    not report it (e.g. SAMD21)."""
+    results = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 3:
+                continue
+            ram = int(fields[3]) if len(fields) >= 4 else -1
+            results[int(fields[0])] = (int(fields[1]), ram)
+    return results
+
+
+def deltas(results):
+    """Return the (flash, ram) deltas relative to FEATURE 0."""
+    base_flash, base_ram = results[0]
+    return {
+        feature: (None if flash < 0 else flash - base_flash,
+                  None if ram < 0 else ram - base_ram)
+        for feature, (flash, ram) in results.items()
+    }
+
+
+def check(delta, base_delta, min_bytes, tolerance):
+    """Return the status of a single delta."""
+    if delta is None or base_delta is None:
+        return 'ok'
+    threshold = max(min_bytes, tolerance * abs(base_delta))
+    if delta - base_delta > threshold:
+        return 'REGRESSION'
+    if base_delta - delta > threshold:
+        return 'smaller'
+    return 'ok'
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare MemoryBenchmark results against a baseline')
+    parser.add_argument('--flash-bytes', type=int, default=32,
+                        help='Minimum flash threshold in bytes (default 32)')
+    parser.add_argument('--ram-bytes', type=int, default=8,
+                        help='Minimum RAM threshold in bytes (default 8)')
+    parser.add_argument('--tolerance', type=float, default=0.05,
+                        help='Fraction of the baseline delta (default 0.05)')
+    parser.add_argument('--program', default='MemoryBenchmark.ino',
+                        help='Program containing the FEATURE_XXX labels')
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    args = parser.parse_args()
+
+    labels = read_labels(args.program)
+    baseline = deltas(read_results(args.baseline))
+    current = deltas(read_results(args.current))
+
+    def fmt(value):
+        return '-' if value is None else str(value)
+
+    print('%-26s %15s %15s  %s' % (
+        'feature', 'flash(base/cur)', 'ram(base/cur)', 'status'))
+    failures = 0
+    for feature in sorted(baseline):
+        if feature == 0:
+            continue
+        name = labels.get(feature, str(feature))
+        base_flash, base_ram = baseline[feature]
+        if feature not in current:
+            print('%-26s %15s %15s  %s' % (name, '-', '-', 'MISSING'))
+            failures += 1
+            continue
+
+        cur_flash, cur_ram = current[feature]
+        flash_status = check(
+            cur_flash, base_flash, args.flash_bytes, args.tolerance)
+        ram_status = check(cur_ram, base_ram, args.ram_bytes, args.tolerance)
+        if 'REGRESSION' in (flash_status, ram_status):
+            status = 'REGRESSION'
+            failures += 1
+        elif 'smaller' in (flash_status, ram_status):
+            status = 'smaller'
+        else:
+            status = 'ok'
+        print('%-26s %15s %15s  %s' % (
+            name,
+            '%s/%s' % (fmt(base_flash), fmt(cur_flash)),
+            '%s/%s' % (fmt(base_ram), fmt(cur_ram)),
+            status))
+
+    for feature in sorted(current):
+        if feature not in baseline:
+            name = labels.get(feature, str(feature))
+            cur_flash, cur_ram = current[feature]
+            print('%-26s %15s %15s  %s' % (
+                name, '-/' + fmt(cur_flash), '-/' + fmt(cur_ram), 'new'))
+
+    if failures > 0:
+        print('FAILED: %d feature(s) regressed or missing' % failures)
+        sys.exit(1)
+    print('PASSED')
+
+
+if __name__ == '__main__':
+    main()
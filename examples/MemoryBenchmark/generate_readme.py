@@ -53,6 +53,30 @@ generates this `README.md` file. The ASCII tables below are generated by the
 `generate_table.awk` script, which takes each `*.txt` file and converts it to an
 ASCII table.
 
+The `make gate` target compiles each `FEATURE` under EpoxyDuino with `-Os` and
+dead code elimination, then the `compare_memory.py` script checks the flash and
+ram deltas against the baseline in `epoxy.txt`. A delta that grew by more than
+32 bytes of flash (8 bytes of ram), and more than 5%, fails the gate. The
+baseline depends on the compiler of the host machine, so it is not checked into
+the repository. It must be recorded with `make gate_baseline` before the first
+`make gate`, which fails if `epoxy.txt` is missing.
+
+The `speed_vs_size.py` script joins the flash and ram deltas of a board with
+the CPU times of the same functions in [AutoBenchmark](../AutoBenchmark), to
+show the trade-off between alternative implementations of the same
+functionality (e.g. `printPad5To()` and `printPadTo<5>()`, or
+`Print::print(double)` and `printFloatTo()`). The `make speed_vs_size` target
+prints the table for every board:
+
+```
+$ ./speed_vs_size.py nano.txt ../AutoBenchmark/nano.txt
+$ make speed_vs_size
+```
+
+Each new fast or compact variant gets its own `FEATURE` in
+`MemoryBenchmark.ino`, a benchmark of the same code in AutoBenchmark, and an
+entry in the `GROUPS` table of `speed_vs_size.py`.
+
 ## Library Size Changes
 
 **v1.4.5**
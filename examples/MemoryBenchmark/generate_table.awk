@@ -28,6 +28,16 @@ BEGIN {
   labels[19] = "KString::compareTo(KString&)"
   labels[20] = "backslashXEncode()"
   labels[21] = "backslashXDecode()"
+  labels[22] = "printfTo()"
+  labels[23] = "printFormatTo()"
+  labels[24] = "printPadTo<5>()"
+  labels[25] = "printFixedPointTo<3>()"
+  labels[26] = "Print::print(double)"
+  labels[27] = "printFloatTo(float)"
+  labels[28] = "hexEncode()"
+  labels[29] = "hexDecode()"
+  labels[30] = "base64Encode()"
+  labels[31] = "base64Decode()"
   record_index = 0
 }
 {
@@ -64,6 +74,10 @@ END {
         || labels[i] ~ /^isSorted\(\)/ \
         || labels[i] ~ /^KString::compareTo\(char\*\)/ \
         || labels[i] ~ /^backslashXEncode\(\)/ \
+        || labels[i] ~ /^printfTo\(\)/ \
+        || labels[i] ~ /^printPadTo<5>\(\)/ \
+        || labels[i] ~ /^Print::print\(double\)/ \
+        || labels[i] ~ /^hexEncode\(\)/ \
     ) {
       printf(\
         "|----------------------------------------+--------------+-------------|\n")
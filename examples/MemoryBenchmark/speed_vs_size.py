@@ -0,0 +1,140 @@
+#!/usr/bin/python3
+#
+# Join the flash and static RAM usage of each FEATURE collected by collect.sh
+# (or collect_epoxy.sh) with the CPU time of the matching benchmarks collected
+# by ../AutoBenchmark, for a single board, and print an ASCII table showing the
+# speed-versus-size trade-off between alternative implementations of the same
+# functionality.
+#
+# The AutoBenchmark file can be either the text format (e.g. nano.txt) or the
+# JSON format (e.g. epoxy.json).
+#
+# Usage: speed_vs_size.py memory.txt autobenchmark.txt
+#
+# For example:
+#
+#   $ ./speed_vs_size.py nano.txt ../AutoBenchmark/nano.txt
+
+import argparse
+import json
+
+from compare_memory import deltas
+from compare_memory import read_labels
+from compare_memory import read_results
+
+# Groups of alternative implementations. Each entry maps the FEATURE_XXX name
+# in MemoryBenchmark.ino to the names of the benchmarks in AutoBenchmark which
+# measure the same code. When a new fast or compact variant is added, give it
+# a FEATURE in MemoryBenchmark.ino, a benchmark in AutoBenchmark, and an entry
+# next to the other variants here.
+GROUPS = [
+    [
+        ('NATIVE_DIV_1000', ['/1000']),
+        ('UDIV_1000', ['udiv1000()']),
+    ],
+    [
+        ('PRINT_PAD_5_TO', ['printPad5To()']),
+        ('PRINT_PAD_TO_5', ['printPadTo<5>()']),
+    ],
+    [
+        ('PRINT_UINT32_AS_FLOAT3_TO', ['printUint32AsFloat3To()']),
+        ('PRINT_FIXED_POINT_TO_3', ['printFixedPointTo<3>()']),
+    ],
+    [
+        ('PRINT_DOUBLE', ['Print::print(double)']),
+        ('PRINT_FLOAT_TO', ['printFloatTo(float)']),
+    ],
+    [
+        ('PRINTF_TO', ['printfTo()']),
+        ('PRINT_FORMAT_TO', ['printFormatTo()']),
+    ],
+    [
+        ('KSTRING_COMPARE_TO_CSTRING', ['KString::compareTo()']),
+    ],
+    [
+        ('HASH_DJB2_CSTRING', ['hashDjb2()/8', 'hashDjb2()/64']),
+    ],
+    [
+        ('BACKSLASH_X_ENCODE',
+            ['backslashXEncode()/8', 'backslashXEncode()/64']),
+        ('HEX_ENCODE', ['hexEncode()/8', 'hexEncode()/64']),
+        ('BASE64_ENCODE', ['base64Encode()/8', 'base64Encode()/64']),
+    ],
+    [
+        ('HEX_DECODE', ['hexDecode()/8', 'hexDecode()/64']),
+        ('BASE64_DECODE', ['base64Decode()/8', 'base64Decode()/64']),
+    ],
+]
+
+
+def read_benchmarks(path):
+    """Return a dict of benchmark name to the average micros per iteration,
+    from the lines between BENCHMARKS and END of an AutoBenchmark result
+    file, in either the text or the JSON format."""
+    results = {}
+    in_benchmarks = False
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line == 'BENCHMARKS':
+                in_benchmarks = True
+            elif line == 'END':
+                in_benchmarks = False
+            elif not in_benchmarks or line == '':
+                continue
+            elif line.startswith('{'):
+                record = json.loads(line)
+                results[record['name']] = record['avgNanos'] / 1000.0
+            else:
+                fields = line.split()
+                if len(fields) >= 3:
+                    results[fields[0]] = float(fields[2])
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Print the speed versus size of alternative features')
+    parser.add_argument('--program', default='MemoryBenchmark.ino',
+                        help='Program containing the FEATURE_XXX labels')
+    parser.add_argument('memory')
+    parser.add_argument('benchmarks')
+    args = parser.parse_args()
+
+    features = {name: n for n, name in read_labels(args.program).items()}
+    memory = deltas(read_results(args.memory))
+    benchmarks = read_benchmarks(args.benchmarks)
+
+    def fmt_memory(feature):
+        delta = memory.get(features.get(feature))
+        if delta is None or delta[0] is None:
+            return '-'
+        flash, ram = delta
+        return '%6d/%5s' % (flash, '-' if ram is None else ram)
+
+    def fmt_micros(name):
+        micros = benchmarks.get(name)
+        return '-' if micros is None else '%.3f' % micros
+
+    separator = \
+        '+-----------------------------+--------------+' \
+        '--------------------------+---------+'
+    print(separator)
+    print('| Feature                     | delta flash/ |'
+          ' Benchmark                | micros  |')
+    print('|                             |          ram |'
+          '                          |         |')
+    for group in GROUPS:
+        print(separator)
+        for feature, names in group:
+            for i, name in enumerate(names):
+                print('| %-27s | %12s | %-24s | %7s |' % (
+                    feature if i == 0 else '',
+                    fmt_memory(feature) if i == 0 else '',
+                    name,
+                    fmt_micros(name)))
+    print(separator)
+
+
+if __name__ == '__main__':
+    main()
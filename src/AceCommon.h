@@ -43,27 +43,44 @@ SOFTWARE.
 #error Platforms using ArduinoCore-API not supported
 #endif
 
+#include "optimize/optimize.h"
+
 #include "arithmetic/arithmetic.h"
 
 #include "pstrings/pstrings.h"
 #include "fstrings/FCString.h"
 #include "fstrings/FlashString.h"
+#include "fstrings/FlashStringReader.h"
 #include "kstrings/KString.h"
 #include "tstrings/tstrings.h"
 #include "cstrings/copyReplace.h"
+#include "cstrings/CharReplacer.h"
+#include "cstrings/PatternReplacer.h"
 
 #include "print_str/PrintStr.h"
 
 #include "print_utils/printPadTo.h"
 #include "print_utils/printfTo.h"
+#include "print_utils/printFormatTo.h"
 #include "print_utils/printReplaceTo.h"
 #include "print_utils/printIntAsFloat.h"
+#include "print_utils/printFloatTo.h"
+#include "parse_utils/parseInt.h"
 
 #include "timing_stats/TimingStats.h"
 #include "timing_stats/GenericStats.h"
+#include "timing_stats/TimingHistogram.h"
+#include "timing_stats/ConcurrentTimingStats.h"
+#include "timing_stats/WindowedStats.h"
+#include "timing_stats/CycleClock.h"
+#include "timing_stats/ScopedTimer.h"
+#include "timing_stats/TimingProbes.h"
+#include "benchmark/Benchmark.h"
 
 #include "url_encoding/url_encoding.h"
 #include "backslash_x_encoding/backslash_x_encoding.h"
+#include "hex_encoding/hex_encoding.h"
+#include "base64_encoding/base64_encoding.h"
 
 #include "hash/djb2.h"
 
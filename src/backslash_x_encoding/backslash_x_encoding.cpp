@@ -104,6 +104,17 @@ uint8_t backslashXDecode(char* t, size_t tcap, const char* s, size_t* written) {
       } else {
         if (escape != 'x') break;
 
+#if ACE_COMMON_HEX_CHAR_TABLE
+        // A single lookup validates and decodes each "H" character. The NUL
+        // at the end of the string is not a valid hexadecimal character.
+        uint8_t high = internal::hexValue(*s++);
+        if (high & 0xF0) break;
+
+        uint8_t low = internal::hexValue(*s++);
+        if (low & 0xF0) break;
+
+        c = (high << 4) | low;
+#else
         // Verify that "HH" characters are valid hexadecimal.
         char high = *s++;
         if (high == '\0') break;
@@ -114,6 +125,7 @@ uint8_t backslashXDecode(char* t, size_t tcap, const char* s, size_t* written) {
         if (! isHexChar(low)) break;
 
         c = (hexCharToByte(high) << 4) | hexCharToByte(low);
+#endif
       }
     } else if (c < ' ' || c >= 127) {
       // If source string contains any unprintable character, mark as error.
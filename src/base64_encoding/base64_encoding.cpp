@@ -0,0 +1,284 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <Arduino.h> // PROGMEM, pgm_read_byte()
+#include <Print.h>
+#include "base64_encoding.h"
+
+namespace ace_common {
+
+namespace internal {
+
+/** Base64 alphabet from RFC 4648, Table 1. */
+static const char kBase64Alphabet[64] PROGMEM = {
+  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+  'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+  'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+  'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+  'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+  'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+  'w', 'x', 'y', 'z', '0', '1', '2', '3',
+  '4', '5', '6', '7', '8', '9', '+', '/',
+};
+
+/** Base64url alphabet from RFC 4648, Table 2. */
+static const char kBase64UrlAlphabet[64] PROGMEM = {
+  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+  'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+  'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+  'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+  'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+  'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+  'w', 'x', 'y', 'z', '0', '1', '2', '3',
+  '4', '5', '6', '7', '8', '9', '-', '_',
+};
+
+/** The first character covered by the decoding tables ('+'). */
+static const uint8_t kDecodeFirst = 0x2B;
+
+/** The number of characters covered by the decoding tables ('+' to 'z'). */
+static const uint8_t kDecodeSize = 80;
+
+/**
+ * Map of the characters '+' to 'z' into their Base64 value. Invalid characters
+ * map to 0xFF. Characters outside of this range are always invalid, which
+ * saves 176 bytes of flash compared to a full 256-entry table.
+ */
+static const uint8_t kBase64Values[kDecodeSize] PROGMEM = {
+  0x3E, 0xFF, 0xFF, 0xFF, 0x3F, 0x34, 0x35, 0x36,
+  0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+  0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x1B,
+  0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+  0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B,
+  0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+};
+
+/** Same as kBase64Values, for the Base64url alphabet. */
+static const uint8_t kBase64UrlValues[kDecodeSize] PROGMEM = {
+  0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0x34, 0x35, 0x36,
+  0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+  0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x1A, 0x1B,
+  0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+  0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B,
+  0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+};
+
+/**
+ * Encode the group of `count` (1-3) bytes in `s` into `t` using the given
+ * `alphabet`. If `pad` is true, 4 characters are always written, otherwise
+ * `count + 1` characters are written. Returns the number of characters
+ * written.
+ */
+static uint8_t encodeGroup(char* t, const uint8_t* s, uint8_t count,
+    const char* alphabet, bool pad) {
+  uint32_t v = (uint32_t) s[0] << 16;
+  if (count > 1) v |= (uint16_t) s[1] << 8;
+  if (count > 2) v |= s[2];
+
+  t[0] = (char) pgm_read_byte(&alphabet[(v >> 18) & 0x3F]);
+  t[1] = (char) pgm_read_byte(&alphabet[(v >> 12) & 0x3F]);
+  if (count > 1) {
+    t[2] = (char) pgm_read_byte(&alphabet[(v >> 6) & 0x3F]);
+  } else if (pad) {
+    t[2] = '=';
+  }
+  if (count > 2) {
+    t[3] = (char) pgm_read_byte(&alphabet[v & 0x3F]);
+  } else if (pad) {
+    t[3] = '=';
+  }
+  return pad ? 4 : count + 1;
+}
+
+static uint8_t encode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written, const char* alphabet, bool pad) {
+  // No room even for the NUL terminator, so nothing can be written.
+  if (tcap == 0) {
+    if (written) {
+      *written = 0;
+    }
+    return (n > 0) ? 1 : 0;
+  }
+
+  char* tt = t;
+  char* const tend = t + tcap - 1;
+  uint8_t status = 0;
+
+  while (n > 0) {
+    uint8_t count = (n < 3) ? n : 3;
+    uint8_t len = pad ? 4 : count + 1;
+    if (tend - tt < len) {
+      status = 1;
+      break;
+    }
+    tt += encodeGroup(tt, s, count, alphabet, pad);
+    s += count;
+    n -= count;
+  }
+
+  *tt = '\0';
+  if (written) {
+    *written = tt - t;
+  }
+  return status;
+}
+
+/**
+ * Decode the Base64 string `s` into `tt` using the given decoding `table`.
+ * The `tt` is advanced past the bytes which were written.
+ */
+static uint8_t decode(uint8_t*& tt, uint8_t* const tend, const char* s,
+    const uint8_t* table) {
+  uint32_t acc = 0;
+  uint8_t count = 0;
+  uint8_t c;
+
+  while (true) {
+    c = *s++;
+    if (c == '\0' || c == '=') break;
+
+    uint8_t index = c - kDecodeFirst;
+    if (index >= kDecodeSize) return 2;
+    uint8_t v = pgm_read_byte(&table[index]);
+    if (v & 0xC0) return 2;
+
+    acc = (acc << 6) | v;
+    count++;
+    if (count == 4) {
+      if (tend - tt < 3) return 1;
+      tt[0] = acc >> 16;
+      tt[1] = acc >> 8;
+      tt[2] = acc;
+      tt += 3;
+      acc = 0;
+      count = 0;
+    }
+  }
+
+  // A single trailing character cannot encode a complete byte.
+  if (count == 1) return 2;
+
+  // Verify that the optional padding completes the final group.
+  if (c == '=') {
+    if (count == 0) return 2;
+    uint8_t pads = 1;
+    while (*s == '=') {
+      pads++;
+      s++;
+    }
+    if (*s != '\0' || pads != 4 - count) return 2;
+  }
+
+  // Write the remaining 1 or 2 bytes of the final group.
+  if (count > 1) {
+    if (tend - tt < count - 1) return 1;
+    if (count == 2) {
+      *tt++ = acc >> 4;
+    } else {
+      *tt++ = acc >> 10;
+      *tt++ = acc >> 2;
+    }
+  }
+  return 0;
+}
+
+static size_t printTo(Print& printer, const void* s, size_t n,
+    const char* alphabet, bool pad) {
+  const uint8_t* ss = (const uint8_t*) s;
+
+  // Holds 8 groups of 4 characters, small enough for an 8-bit processor.
+  const uint8_t kBufSize = 32;
+  char buf[kBufSize];
+
+  size_t total = 0;
+  while (n > 0) {
+    char* b = buf;
+    while (n > 0 && b < buf + kBufSize) {
+      uint8_t count = (n < 3) ? n : 3;
+      b += encodeGroup(b, ss, count, alphabet, pad);
+      ss += count;
+      n -= count;
+    }
+
+    size_t len = b - buf;
+    size_t w = printer.write((const uint8_t*) buf, len);
+    total += w;
+    if (w < len) break;
+  }
+  return total;
+}
+
+} // internal
+
+uint8_t base64Encode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written) {
+  return internal::encode(
+      t, tcap, s, n, written, internal::kBase64Alphabet, true /*pad*/);
+}
+
+uint8_t base64Decode(uint8_t* t, size_t tcap, const char* s, size_t* written) {
+  uint8_t* tt = t;
+  uint8_t status = internal::decode(tt, t + tcap, s, internal::kBase64Values);
+  if (written) {
+    *written = tt - t;
+  }
+  return status;
+}
+
+uint8_t base64UrlEncode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written) {
+  return internal::encode(
+      t, tcap, s, n, written, internal::kBase64UrlAlphabet, false /*pad*/);
+}
+
+uint8_t base64UrlDecode(uint8_t* t, size_t tcap, const char* s,
+    size_t* written) {
+  uint8_t* tt = t;
+  uint8_t status = internal::decode(
+      tt, t + tcap, s, internal::kBase64UrlValues);
+  if (written) {
+    *written = tt - t;
+  }
+  return status;
+}
+
+size_t printBase64To(Print& printer, const void* s, size_t n) {
+  return internal::printTo(
+      printer, s, n, internal::kBase64Alphabet, true /*pad*/);
+}
+
+size_t printBase64UrlTo(Print& printer, const void* s, size_t n) {
+  return internal::printTo(
+      printer, s, n, internal::kBase64UrlAlphabet, false /*pad*/);
+}
+
+}
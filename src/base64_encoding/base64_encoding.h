@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file base64_encoding.h
+ *
+ * Provides functions to perform Base64 and Base64url encoding and decoding as
+ * described in RFC 4648 (https://tools.ietf.org/html/rfc4648). The Base64
+ * version uses `+` and `/` for the 62nd and 63rd characters and pads the
+ * output with `=`. The Base64url version uses `-` and `_` instead, and omits
+ * the padding.
+ */
+
+#ifndef ACE_COMMON_BASE64_ENCODING_H
+#define ACE_COMMON_BASE64_ENCODING_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+class Print;
+
+namespace ace_common {
+
+/**
+ * Encode the `n` bytes in `s` using Base64 into the target string `t` with
+ * capacity `tcap`. The target `t` is always NUL-terminated. The encoded string
+ * is padded with `=` to a multiple of 4 characters, so `tcap` must be at least
+ * `4*ceil(n/3)+1` to hold the entire result. If `t` runs out of capacity, only
+ * the complete 4-character groups which fit are written.
+ *
+ * @param t target c-string
+ * @param tcap capacity of t
+ * @param s source array of bytes
+ * @param n number of bytes in s
+ * @param written (nullable) the number of characters written to 't'
+ * @return 0 status if successful, 1 if 't' ran out of capacity
+ */
+uint8_t base64Encode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written);
+
+/**
+ * Decode the NUL-terminated Base64 string `s` into bytes in `t` with capacity
+ * `tcap`. The trailing `=` padding characters are optional. The target `t` is
+ * an array of bytes and is *not* NUL-terminated.
+ *
+ * @param t target array of bytes
+ * @param tcap capacity of t
+ * @param s source c-string
+ * @param written (nullable) the number of bytes written to 't'
+ * @return 0 status if successful; 1 if 't' ran out of capacity; 2 if 's' was
+ *    ill-formed (e.g. an invalid character, or an incomplete group)
+ */
+uint8_t base64Decode(uint8_t* t, size_t tcap, const char* s, size_t* written);
+
+/**
+ * Same as base64Encode() but using the Base64url alphabet, without padding.
+ * The size of the encoded string is `ceil(4*n/3)`, so `tcap` must be at least
+ * 1 larger than that.
+ */
+uint8_t base64UrlEncode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written);
+
+/**
+ * Same as base64Decode() but using the Base64url alphabet. The trailing `=`
+ * padding characters are accepted but not required.
+ */
+uint8_t base64UrlDecode(uint8_t* t, size_t tcap, const char* s,
+    size_t* written);
+
+/**
+ * Print the `n` bytes in `s` encoded in Base64 to the `printer`. The
+ * characters are collected in a small buffer on the stack and sent to the
+ * printer in blocks using `Print::write(buf, size)`.
+ *
+ * @return number of characters written to `printer`
+ */
+size_t printBase64To(Print& printer, const void* s, size_t n);
+
+/**
+ * Same as printBase64To() but using the Base64url alphabet, without padding.
+ *
+ * @return number of characters written to `printer`
+ */
+size_t printBase64UrlTo(Print& printer, const void* s, size_t n);
+
+}
+
+#endif
@@ -0,0 +1,347 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_BENCHMARK_H
+#define ACE_COMMON_BENCHMARK_H
+
+#include <stdint.h>
+#include <Arduino.h> // yield(), pgm_read_byte()
+#include "../print_utils/printIntAsFloat.h" // printFixedPointTo()
+#include "../timing_stats/TimingStats.h"
+#include "../timing_stats/GenericStats.h"
+#include "../timing_stats/TimingHistogram.h"
+#include "../timing_stats/CycleClock.h"
+
+namespace ace_common {
+
+/**
+ * Prevent the compiler from optimizing away the calculation of `value`, by
+ * pretending to read it in an empty assembly statement. Use this instead of
+ * assigning the value to a `volatile` variable, which costs a store to memory.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m" (value) : "memory");
+}
+
+/**
+ * Prevent the compiler from reordering memory reads and writes across this
+ * point, or from caching values from memory in registers.
+ */
+inline void clobberMemory() {
+  asm volatile("" : : : "memory");
+}
+
+namespace internal {
+
+/** Return true if the stats can calculate percentiles. */
+template <typename Stats>
+bool hasPercentiles(const Stats& /*stats*/) { return false; }
+
+/** Return true if the stats can calculate percentiles. */
+template <uint8_t SubBucketBits, uint8_t MaxBits, typename C>
+bool hasPercentiles(
+    const TimingHistogram<SubBucketBits, MaxBits, C>& /*stats*/) {
+  return true;
+}
+
+/** Return the percentile of the stats, or 0 if it is not supported. */
+template <typename Stats>
+uint32_t getPercentile(const Stats& /*stats*/, uint8_t /*percent*/) {
+  return 0;
+}
+
+/** Return the percentile of the histogram. */
+template <uint8_t SubBucketBits, uint8_t MaxBits, typename C>
+uint32_t getPercentile(
+    const TimingHistogram<SubBucketBits, MaxBits, C>& stats,
+    uint8_t percent) {
+  return stats.getPercentile(percent);
+}
+
+/** Return true if the stats can calculate the standard deviation. */
+template <typename Stats>
+bool hasStdDev(const Stats& /*stats*/) { return false; }
+
+/** Return true if the stats can calculate the standard deviation. */
+template <typename T, typename Sum, typename C>
+bool hasStdDev(const GenericStats<T, Sum, C, true>& /*stats*/) {
+  return true;
+}
+
+/** Return the standard deviation rounded to an integer, or 0. */
+template <typename Stats>
+uint32_t getStdDev(const Stats& /*stats*/) { return 0; }
+
+/** Return the standard deviation of the GenericStats, rounded. */
+template <typename T, typename Sum, typename C>
+uint32_t getStdDev(const GenericStats<T, Sum, C, true>& stats) {
+  return (uint32_t) (stats.getStdDev() + 0.5);
+}
+
+/** Print the name stored in flash as a JSON string, with quotes. */
+void printJsonStringTo(Print& printer, const __FlashStringHelper* name);
+
+}
+
+/**
+ * Run micro benchmarks of small pieces of code, and print the time taken by
+ * each iteration, to 3 decimal places. For each benchmark:
+ *
+ *  1. The number of iterations is calibrated, unless fixed by
+ *     `setIterations()`, so that each sample takes about `setSampleMicros()`
+ *     micros.
+ *  2. Each of the `setSamples()` samples calls the `body(i)` lambda in a loop
+ *     for that number of iterations, then calls the `baseline(i)` lambda for
+ *     the same number of iterations, and subtracts the two durations to
+ *     remove the overhead of the loop itself.
+ *  3. The net duration of each sample, in nanoseconds, is added to the
+ *     `Stats` object (e.g. `TimingStatsT` or `TimingHistogram`).
+ *  4. The min, avg and max durations of one iteration are printed, in micros
+ *     for the text format, or in nanos for the CSV and JSON formats.
+ *
+ * The result of the code under test should be passed to `doNotOptimize()` so
+ * that the compiler does not remove the code:
+ *
+ * @code
+ * Benchmark benchmark(Serial);
+ * benchmark.run(F("decToBcd()"), [](uint32_t i) {
+ *   doNotOptimize(decToBcd(i & 0xFF));
+ * });
+ * @endcode
+ *
+ * @tparam Stats class of the statistics of the samples, with an
+ *    `update(uint32_t)` method. The percentiles (p50, p95) are printed if it
+ *    is a `TimingHistogram`. The standard deviation is printed in the CSV and
+ *    JSON formats if it is a `GenericStats` whose `Variance` is true. The
+ *    samples are in nanoseconds, so the `MaxBits` of the histogram must be at
+ *    least 23 for the default sample duration of 5000 micros.
+ * @tparam Clock clock source, `CycleClock` (default) or `MicrosClock`
+ */
+template <typename Stats, typename Clock = CycleClock>
+class BenchmarkT {
+  public:
+    /** Print `name min avg max iterations samples [p50 p95]`. */
+    static const uint8_t kFormatText = 0;
+
+    /**
+     * Print a CSV header line, then one CSV line per benchmark, with the
+     * times in nanos instead of micros.
+     */
+    static const uint8_t kFormatCsv = 1;
+
+    /** Print one JSON object per line (JSON Lines), in nanos. */
+    static const uint8_t kFormatJson = 2;
+
+    /** Default number of samples. */
+    static const uint8_t kDefaultSamples = 20;
+
+    /** Default duration of each sample in micros. */
+    static const uint32_t kDefaultSampleMicros = 5000;
+
+    /** Upper limit of the calibrated number of iterations. */
+    static const uint32_t kMaxIterations = 0x40000000;
+
+    /** Constructor. */
+    explicit BenchmarkT(Print& printer, uint8_t format = kFormatText):
+        mPrinter(printer),
+        mFormat(format)
+    {}
+
+    /** Set the number of samples of each benchmark. */
+    void setSamples(uint8_t samples) { mSamples = samples; }
+
+    /** Set the target duration of each sample, used by the calibration. */
+    void setSampleMicros(uint32_t micros) { mSampleMicros = micros; }
+
+    /** Set a fixed number of iterations, or 0 to calibrate it (default). */
+    void setIterations(uint32_t iterations) { mIterations = iterations; }
+
+    /**
+     * Run the benchmark named `name`, calling `body(i)` for each iteration,
+     * and print the result. The overhead of the loop is measured using a
+     * baseline which only passes `i` to doNotOptimize().
+     */
+    template <typename Body>
+    void run(const __FlashStringHelper* name, Body body) {
+      run(name, body, [](uint32_t i) { doNotOptimize(i); });
+    }
+
+    /**
+     * Run the benchmark named `name`, calling `body(i)` for each iteration,
+     * and subtracting the duration of `baseline(i)`, which should prepare the
+     * same arguments as `body(i)` without calling the code under test.
+     */
+    template <typename Body, typename Baseline>
+    void run(const __FlashStringHelper* name, Body body, Baseline baseline) {
+      yield();
+      mLastIterations = (mIterations > 0) ? mIterations : calibrate(body);
+
+      mStats.reset();
+      for (uint8_t k = 0; k < mSamples; k++) {
+        yield();
+        uint32_t rawTicks = timeLoop(body, mLastIterations);
+        uint32_t emptyTicks = timeLoop(baseline, mLastIterations);
+        // The baseline can be slower than the body if the code under test is
+        // faster than the measurement error.
+        uint32_t netTicks = (rawTicks > emptyTicks) ? rawTicks - emptyTicks : 0;
+        mStats.update(Clock::toNanos(netTicks));
+      }
+
+      printResult(name);
+    }
+
+    /** Return the stats of the samples of the last benchmark, in nanos. */
+    const Stats& getStats() const { return mStats; }
+
+    /** Return the number of iterations of the last benchmark. */
+    uint32_t getIterations() const { return mLastIterations; }
+
+  private:
+    // disable copy-constructor and assignment operator
+    BenchmarkT(const BenchmarkT&) = delete;
+    BenchmarkT& operator=(const BenchmarkT&) = delete;
+
+    /** Return the ticks taken by `iterations` calls of `body`. */
+    template <typename Body>
+    static uint32_t timeLoop(Body& body, uint32_t iterations) {
+      uint32_t startTicks = Clock::now();
+      for (uint32_t i = 0; i < iterations; i++) {
+        body(i);
+      }
+      return Clock::now() - startTicks;
+    }
+
+    /**
+     * Double the number of iterations until the loop takes at least 1/8 of
+     * the target duration of a sample, and at least 1 tick, then scale it
+     * linearly to the target. The target is at least 8 ticks, so that a very
+     * small setSampleMicros() still measures something with a coarse clock
+     * (e.g. `micros()`).
+     */
+    template <typename Body>
+    uint32_t calibrate(Body& body) {
+      uint32_t targetTicks = mSampleMicros * Clock::ticksPerMicro();
+      if (targetTicks < 8) targetTicks = 8;
+      uint32_t iterations = 1;
+      uint32_t elapsedTicks;
+      while (true) {
+        elapsedTicks = timeLoop(body, iterations);
+        if (elapsedTicks > 0 && elapsedTicks >= targetTicks / 8) break;
+        if (iterations >= kMaxIterations) return kMaxIterations;
+        iterations *= 2;
+      }
+
+      uint64_t scaled = (uint64_t) iterations * targetTicks / elapsedTicks;
+      if (scaled < 1) return 1;
+      if (scaled > kMaxIterations) return kMaxIterations;
+      return (uint32_t) scaled;
+    }
+
+    void printResult(const __FlashStringHelper* name) {
+      bool percentiles = internal::hasPercentiles(mStats);
+      bool stdDev = (mFormat != kFormatText) && internal::hasStdDev(mStats);
+
+      if (mFormat == kFormatCsv && ! mIsHeaderPrinted) {
+        mIsHeaderPrinted = true;
+        mPrinter.print(F("name,minNanos,avgNanos,maxNanos,iterations,samples"));
+        if (stdDev) mPrinter.print(F(",stdDevNanos"));
+        if (percentiles) mPrinter.print(F(",p50Nanos,p95Nanos"));
+        mPrinter.println();
+      }
+
+      if (mFormat == kFormatJson) {
+        mPrinter.print(F("{\"name\":"));
+        internal::printJsonStringTo(mPrinter, name);
+      } else {
+        mPrinter.print(name);
+      }
+      printTime(F("minNanos"), mStats.getMin());
+      printTime(F("avgNanos"), mStats.getAvg());
+      printTime(F("maxNanos"), mStats.getMax());
+      printCount(F("iterations"), mLastIterations);
+      printCount(F("samples"), mSamples);
+      if (stdDev) {
+        printTime(F("stdDevNanos"), internal::getStdDev(mStats));
+      }
+      if (percentiles) {
+        printTime(F("p50Nanos"), internal::getPercentile(mStats, 50));
+        printTime(F("p95Nanos"), internal::getPercentile(mStats, 95));
+      }
+      if (mFormat == kFormatJson) mPrinter.print('}');
+      mPrinter.println();
+    }
+
+    /** Print the separator, and the key of the field in the JSON format. */
+    void printKey(const __FlashStringHelper* key) {
+      if (mFormat == kFormatJson) {
+        mPrinter.print(F(",\""));
+        mPrinter.print(key);
+        mPrinter.print(F("\":"));
+      } else {
+        mPrinter.print((mFormat == kFormatCsv) ? ',' : ' ');
+      }
+    }
+
+    /**
+     * Print the duration of one iteration, given the duration of a sample in
+     * nanos. The text format prints micros with 3 decimal places, for
+     * generate_table.awk. The CSV and JSON formats print nanos with 3
+     * decimal places, so that the regression checks can see the difference
+     * between functions which take less than a microsecond.
+     */
+    void printTime(const __FlashStringHelper* key, uint32_t sampleNanos) {
+      printKey(key);
+      if (mFormat == kFormatText) {
+        printUint32AsFloat3To(mPrinter, sampleNanos / mLastIterations);
+      } else {
+        printFixedPointTo<3>(
+            mPrinter, (uint64_t) sampleNanos * 1000 / mLastIterations);
+      }
+    }
+
+    void printCount(const __FlashStringHelper* key, uint32_t count) {
+      printKey(key);
+      mPrinter.print(count);
+    }
+
+    Print& mPrinter;
+    Stats mStats;
+    uint32_t mSampleMicros = kDefaultSampleMicros;
+    uint32_t mIterations = 0;
+    uint32_t mLastIterations = 1;
+    uint8_t const mFormat;
+    uint8_t mSamples = kDefaultSamples;
+    bool mIsHeaderPrinted = false;
+};
+
+/**
+ * A BenchmarkT which collects the min, avg and max of the samples using
+ * the CycleClock.
+ */
+typedef BenchmarkT<TimingStatsT<uint32_t, uint64_t>> Benchmark;
+
+}
+
+#endif
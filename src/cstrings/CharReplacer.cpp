@@ -0,0 +1,53 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string.h> // memset(), strchr()
+#include <Arduino.h> // pgm_read_ptr()
+#include "../fstrings/FlashString.h" // ACE_COMMON_UNIFIED_FLASH
+#include "CharReplacer.h"
+
+namespace ace_common {
+
+void CharReplacer::init() {
+  memset(bitmap_, 0, sizeof(bitmap_));
+  for (const char* s = oldChars_; *s != '\0'; s++) {
+    uint8_t u = (uint8_t) *s;
+    bitmap_[u >> 3] |= (1 << (u & 0x7));
+  }
+}
+
+size_t CharReplacer::printReplacementTo(Print& printer, char c) const {
+  const char* p = strchr(oldChars_, c);
+  if (p == nullptr || c == '\0') return 0;
+  uint8_t i = p - oldChars_;
+
+  if (ACE_COMMON_UNIFIED_FLASH || stringType_ == kTypeCstring) {
+    return printer.print((const char*) newStrings_[i]);
+  } else {
+    return printer.print((const __FlashStringHelper*)
+        pgm_read_ptr(newStrings_ + i));
+  }
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_CHAR_REPLACER_H
+#define ACE_COMMON_CHAR_REPLACER_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+class __FlashStringHelper;
+class Print;
+
+namespace ace_common {
+
+/**
+ * A table which maps a set of characters to their replacement strings, used by
+ * printReplaceCharsTo() and copyReplaceChars() to replace multiple different
+ * characters in a single pass over the source string. For example, the 5
+ * characters which must be escaped in HTML can be replaced using:
+ *
+ * @code
+ * const char* const HTML_ESCAPES[] = {
+ *   "&amp;", "&lt;", "&gt;", "&quot;", "&#39;"
+ * };
+ * CharReplacer htmlReplacer("&<>\"'", HTML_ESCAPES);
+ *
+ * printReplaceCharsTo(printer, "a<b", htmlReplacer); // prints "a&lt;b"
+ * @endcode
+ *
+ * Membership of every one of the 256 possible characters is recorded in a
+ * 32-byte bitmap, so the common case of a character which is not replaced
+ * costs only a single lookup, no matter how many characters are in the table.
+ * The replacement string itself is located using a linear search through the
+ * `oldChars`, but that happens only for characters which are actually
+ * replaced.
+ *
+ * The `oldChars` and `newStrings` are not copied, so they must remain valid
+ * for the lifetime of this object.
+ */
+class CharReplacer {
+  public:
+    /**
+     * Constructor using replacement strings in normal memory.
+     *
+     * @param oldChars NUL terminated string of the characters to be replaced,
+     *        in normal memory. The NUL character cannot be replaced.
+     * @param newStrings an array of replacement strings in normal memory, one
+     *        for each character in `oldChars`. An empty string "" replaces the
+     *        character with nothing.
+     */
+    explicit CharReplacer(
+        const char* oldChars,
+        const char* const* newStrings
+    ):
+        oldChars_(oldChars),
+        newStrings_((const void* const*) newStrings),
+        stringType_(kTypeCstring)
+    {
+      init();
+    }
+
+    /**
+     * Constructor using replacement strings in flash memory. Similar to the
+     * `keywords` parameter of KString, `newStrings` points to an array in
+     * flash memory which contains pointers to strings also in flash memory.
+     *
+     * @param oldChars NUL terminated string of the characters to be replaced,
+     *        in normal memory. The NUL character cannot be replaced.
+     * @param newStrings an array in flash memory of replacement strings in
+     *        flash memory, one for each character in `oldChars`.
+     */
+    explicit CharReplacer(
+        const char* oldChars,
+        const __FlashStringHelper* const* newStrings
+    ):
+        oldChars_(oldChars),
+        newStrings_((const void* const*) newStrings),
+        stringType_(kTypeFstring)
+    {
+      init();
+    }
+
+    /** Return true if the character `c` should be replaced. */
+    bool contains(char c) const {
+      uint8_t u = (uint8_t) c;
+      return bitmap_[u >> 3] & (1 << (u & 0x7));
+    }
+
+    /**
+     * Print the replacement string of `c` to the printer. The character `c`
+     * must be one of the `oldChars`, as determined by contains().
+     *
+     * @return number of characters printed
+     */
+    size_t printReplacementTo(Print& printer, char c) const;
+
+  private:
+    static const uint8_t kTypeCstring = 0;
+    static const uint8_t kTypeFstring = 1;
+
+    /** Fill in the bitmap from the oldChars_. */
+    void init();
+
+    const char* const oldChars_;
+    const void* const* const newStrings_;
+    uint8_t bitmap_[32];
+    uint8_t const stringType_;
+};
+
+}
+
+#endif
@@ -0,0 +1,144 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <Arduino.h> // pgm_read_byte(), pgm_read_ptr()
+#include "../fstrings/FlashString.h" // ACE_COMMON_UNIFIED_FLASH
+#include "PatternReplacer.h"
+
+namespace ace_common {
+
+void PatternReplacerBase::init() {
+  Node& root = nodes_[0];
+  root.c = '\0';
+  root.child = 0;
+  root.sibling = 0;
+  root.fail = 0;
+  root.match = 0;
+  root.depth = 0;
+  root.pattern = kNoPattern;
+  numNodes_ = 1;
+  valid_ = true;
+
+  for (uint8_t i = 0; i < numPatterns_; i++) {
+    if (! insert(i)) {
+      // Discard the partial trie, so that nothing is ever matched.
+      valid_ = false;
+      root.child = 0;
+      numNodes_ = 1;
+      break;
+    }
+  }
+
+  link();
+}
+
+bool PatternReplacerBase::insert(uint8_t i) {
+  bool isCstring = ACE_COMMON_UNIFIED_FLASH || stringType_ == kTypeCstring;
+  const char* p = isCstring
+      ? (const char*) patterns_[i]
+      : (const char*) pgm_read_ptr(patterns_ + i);
+
+  uint8_t node = 0;
+  while (true) {
+    char c = isCstring ? *p : (char) pgm_read_byte(p);
+    if (c == '\0') break;
+    p++;
+
+    uint8_t child = findChild(node, c);
+    if (child == 0) {
+      if (numNodes_ >= capacity_) return false;
+      if (nodes_[node].depth == 0xFF) return false;
+
+      child = numNodes_++;
+      Node& n = nodes_[child];
+      n.c = c;
+      n.child = 0;
+      n.sibling = nodes_[node].child;
+      n.fail = 0;
+      n.match = 0;
+      n.depth = nodes_[node].depth + 1;
+      n.pattern = kNoPattern;
+      nodes_[node].child = child;
+    }
+    node = child;
+  }
+
+  // Empty patterns are ignored. For duplicate patterns, the first one wins.
+  if (node != 0 && nodes_[node].pattern == kNoPattern) {
+    nodes_[node].pattern = i;
+  }
+  return true;
+}
+
+void PatternReplacerBase::link() {
+  uint8_t maxDepth = 0;
+  for (uint8_t i = 0; i < numNodes_; i++) {
+    if (nodes_[i].depth > maxDepth) maxDepth = nodes_[i].depth;
+  }
+
+  // Process the nodes one level at a time, because the fail link of a node
+  // always points to a node at a lower level, which must be completed first.
+  // This avoids the temporary queue of a normal breadth-first traversal.
+  for (uint8_t d = 0; d < maxDepth; d++) {
+    for (uint8_t parent = 0; parent < numNodes_; parent++) {
+      if (nodes_[parent].depth != d) continue;
+
+      for (uint8_t v = nodes_[parent].child; v != 0; v = nodes_[v].sibling) {
+        Node& n = nodes_[v];
+        n.fail = (parent == 0) ? 0 : next(nodes_[parent].fail, n.c);
+        n.match = (n.pattern != kNoPattern) ? v : nodes_[n.fail].match;
+      }
+    }
+  }
+}
+
+uint8_t PatternReplacerBase::findChild(uint8_t node, char c) const {
+  for (uint8_t v = nodes_[node].child; v != 0; v = nodes_[v].sibling) {
+    if (nodes_[v].c == c) return v;
+  }
+  return 0;
+}
+
+uint8_t PatternReplacerBase::next(uint8_t state, char c) const {
+  while (true) {
+    uint8_t child = findChild(state, c);
+    if (child != 0 || state == 0) return child;
+    state = nodes_[state].fail;
+  }
+}
+
+size_t PatternReplacerBase::printReplacementTo(
+    Print& printer, uint8_t state) const {
+  uint8_t i = nodes_[nodes_[state].match].pattern;
+  if (i == kNoPattern) return 0;
+
+  if (ACE_COMMON_UNIFIED_FLASH || stringType_ == kTypeCstring) {
+    return printer.print((const char*) replacements_[i]);
+  } else {
+    return printer.print((const __FlashStringHelper*)
+        pgm_read_ptr(replacements_ + i));
+  }
+}
+
+}
@@ -0,0 +1,234 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_PATTERN_REPLACER_H
+#define ACE_COMMON_PATTERN_REPLACER_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+class __FlashStringHelper;
+class Print;
+
+namespace ace_common {
+
+/**
+ * Base class of all template instances of PatternReplacer<SIZE>, which
+ * contains all of the code, so that only a single copy is included no matter
+ * how many different SIZE values are used. This is the same technique used by
+ * PrintStrBase and PrintStr<SIZE>.
+ *
+ * This class holds an Aho-Corasick automaton built from a list of patterns, so
+ * that printReplacePatternsTo() and copyReplacePatterns() can replace
+ * occurrences of any of the patterns in a single pass over the source string,
+ * instead of one pass per pattern. The automaton is a trie of the patterns,
+ * stored as an array of nodes, where each node has a `fail` link to the node
+ * representing the longest proper suffix which is also a prefix of a pattern.
+ *
+ * When patterns overlap, the first pattern to be completed wins. If several
+ * patterns are completed at the same character, the longest one wins. After a
+ * replacement, matching starts over from the next character.
+ */
+class PatternReplacerBase {
+  public:
+    /** Return true if all the patterns fit into the nodes of the automaton. */
+    bool isValid() const { return valid_; }
+
+    /** Return the number of nodes used by the automaton, including the root. */
+    uint8_t getNumNodes() const { return numNodes_; }
+
+    /**
+     * Return the next state of the automaton after consuming the character
+     * `c` from the given `state`. The initial state is 0.
+     */
+    uint8_t next(uint8_t state, char c) const;
+
+    /**
+     * Return the length of the pattern which is completed at the given
+     * `state`, or 0 if no pattern was completed.
+     */
+    uint8_t getMatchLength(uint8_t state) const {
+      return nodes_[nodes_[state].match].depth;
+    }
+
+    /**
+     * Print the replacement string of the pattern which was completed at the
+     * given `state`. Should be called only if getMatchLength() is non-zero.
+     *
+     * @return number of characters printed
+     */
+    size_t printReplacementTo(Print& printer, uint8_t state) const;
+
+  protected:
+    /** Node of the trie of patterns. */
+    struct Node {
+      /** The character which leads into this node from its parent. */
+      char c;
+      /** Index of the first child, 0 if none. */
+      uint8_t child;
+      /** Index of the next sibling, 0 if none. */
+      uint8_t sibling;
+      /** Index of the node of the longest proper suffix in the trie. */
+      uint8_t fail;
+      /** Index of the node of the longest pattern which is a suffix. */
+      uint8_t match;
+      /** Length of the string represented by this node. */
+      uint8_t depth;
+      /** Index of the pattern which ends at this node, kNoPattern if none. */
+      uint8_t pattern;
+    };
+
+    /** Value of Node::pattern if no pattern ends at the node. */
+    static const uint8_t kNoPattern = 0xFF;
+
+    /**
+     * Build the trie, then the fail and match links. Must be called by the
+     * subclass constructor, after its array of nodes has been created.
+     */
+    void init();
+
+    /**
+     * Constructor using patterns and replacements in normal memory.
+     *
+     * @param nodes array of nodes created by the subclass
+     * @param capacity number of nodes, no more than 255
+     * @param patterns array of non-empty patterns
+     * @param replacements array of replacement strings, one for each pattern
+     * @param numPatterns number of patterns, no more than 255
+     */
+    PatternReplacerBase(
+        Node* nodes,
+        uint8_t capacity,
+        const char* const* patterns,
+        const char* const* replacements,
+        uint8_t numPatterns
+    ):
+        nodes_(nodes),
+        patterns_((const void* const*) patterns),
+        replacements_((const void* const*) replacements),
+        capacity_(capacity),
+        numPatterns_(numPatterns),
+        stringType_(kTypeCstring)
+    {}
+
+    /**
+     * Constructor using patterns and replacements in flash memory. Similar
+     * to the `keywords` parameter of KString, the `patterns` and
+     * `replacements` point to arrays in flash memory containing pointers to
+     * strings also in flash memory.
+     */
+    PatternReplacerBase(
+        Node* nodes,
+        uint8_t capacity,
+        const __FlashStringHelper* const* patterns,
+        const __FlashStringHelper* const* replacements,
+        uint8_t numPatterns
+    ):
+        nodes_(nodes),
+        patterns_((const void* const*) patterns),
+        replacements_((const void* const*) replacements),
+        capacity_(capacity),
+        numPatterns_(numPatterns),
+        stringType_(kTypeFstring)
+    {}
+
+  private:
+    static const uint8_t kTypeCstring = 0;
+    static const uint8_t kTypeFstring = 1;
+
+    // Disable copy constructor and assignment operator, since nodes_ points
+    // into the subclass.
+    PatternReplacerBase(const PatternReplacerBase&) = delete;
+    PatternReplacerBase& operator=(const PatternReplacerBase&) = delete;
+
+    /** Insert pattern `i` into the trie. Returns false if out of nodes. */
+    bool insert(uint8_t i);
+
+    /** Compute the fail and match links in breadth-first order. */
+    void link();
+
+    /** Return the child of `node` for character `c`, or 0 if none. */
+    uint8_t findChild(uint8_t node, char c) const;
+
+    Node* const nodes_;
+    const void* const* const patterns_;
+    const void* const* const replacements_;
+    uint8_t const capacity_;
+    uint8_t const numPatterns_;
+    uint8_t const stringType_;
+    uint8_t numNodes_;
+    bool valid_;
+};
+
+/**
+ * An Aho-Corasick automaton for a list of patterns with room for `SIZE` nodes
+ * (including the root node), created on the stack or statically. A trie needs
+ * at most one node per character of all the patterns, plus 1 for the root. Use
+ * isValid() to verify that the patterns fit. Each node consumes 7 bytes.
+ *
+ * Usage:
+ *
+ * @code
+ * const char* const PATTERNS[] = {"\\", "\"", "\n", "</"};
+ * const char* const REPLACEMENTS[] = {"\\\\", "\\\"", "\\n", "<\\/"};
+ * PatternReplacer<8> jsonReplacer(PATTERNS, REPLACEMENTS, 4);
+ *
+ * printReplacePatternsTo(printer, src, jsonReplacer);
+ * @endcode
+ *
+ * @tparam SIZE maximum number of nodes in the automaton, at most 255
+ */
+template <uint8_t SIZE>
+class PatternReplacer: public PatternReplacerBase {
+  public:
+    /** Constructor using patterns and replacements in normal memory. */
+    PatternReplacer(
+        const char* const* patterns,
+        const char* const* replacements,
+        uint8_t numPatterns
+    ):
+        PatternReplacerBase(
+            actualNodes_, SIZE, patterns, replacements, numPatterns)
+    {
+      init();
+    }
+
+    /** Constructor using patterns and replacements in flash memory. */
+    PatternReplacer(
+        const __FlashStringHelper* const* patterns,
+        const __FlashStringHelper* const* replacements,
+        uint8_t numPatterns
+    ):
+        PatternReplacerBase(
+            actualNodes_, SIZE, patterns, replacements, numPatterns)
+    {
+      init();
+    }
+
+  private:
+    Node actualNodes_[SIZE];
+};
+
+}
+
+#endif
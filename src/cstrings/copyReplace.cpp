@@ -23,139 +23,216 @@ SOFTWARE.
 */
 
 #include <Arduino.h> // pgm_read_byte()
+#include <Print.h>
+#include "../fstrings/FlashStringReader.h"
+#include "../print_utils/printReplaceTo.h"
 #include "copyReplace.h"
 
 namespace ace_common {
 
-void copyReplaceChar(char* dst, size_t dstSize, const char* src,
-    char oldChar, char newChar) {
-  char c;
-  while ((c = *src++) != '\0' && dstSize > 0) {
-    if (c == oldChar) {
-      if (newChar == '\0') continue;
-      c = newChar;
+namespace internal {
+
+/**
+ * A minimal implementation of Print which writes into the `dst` buffer of
+ * `dstSize`, always leaving room for the NUL terminator. This allows the
+ * copyReplaceXxx() functions which use a CharReplacer or a PatternReplacer to
+ * reuse the corresponding printReplaceXxxTo() functions. Characters which do
+ * not fit are dropped but still counted, to calculate the untruncated length.
+ */
+class CopyPrint: public Print {
+  public:
+    CopyPrint(char* dst, size_t dstSize):
+        dst_(dst),
+        end_(dst + dstSize - 1)
+    {}
+
+    size_t write(uint8_t c) override {
+      length_++;
+      if (dst_ >= end_) return 0;
+      *dst_++ = c;
+      return 1;
     }
-    *dst++ = c;
-    dstSize--;
-  }
 
-  if (dstSize == 0) {
-    --dst;
-  }
-  *dst = '\0';
-}
+    size_t write(const uint8_t *buf, size_t size) override {
+      length_ += size;
+      size_t n = 0;
+      while (n < size && dst_ < end_) {
+        *dst_++ = buf[n++];
+      }
+      return n;
+    }
 
-void copyReplaceChar(char* dst, size_t dstSize, const __FlashStringHelper* src,
+    /** Write the NUL terminator, and return the untruncated length. */
+    size_t terminate() {
+      *dst_ = '\0';
+      return length_;
+    }
+
+  private:
+    char* dst_;
+    char* const end_;
+    size_t length_ = 0;
+};
+
+/**
+ * Implementation of copyReplaceChar().
+ *
+ * @tparam T cstring-like type, a (const char*) or a FlashStringReader
+ */
+template <typename T>
+size_t copyReplaceChar(char* dst, size_t dstSize, T src,
     char oldChar, char newChar) {
+  size_t length = 0;
   char c;
-  const char* s = (const char*) src;
-  while ((c = (char) pgm_read_byte(s++)) != '\0' && dstSize > 0) {
+  while ((c = *src++) != '\0') {
     if (c == oldChar) {
       if (newChar == '\0') continue;
       c = newChar;
     }
-    *dst++ = c;
-    dstSize--;
+    if (length + 1 < dstSize) *dst++ = c;
+    length++;
   }
 
-  if (dstSize == 0) {
-    --dst;
-  }
   *dst = '\0';
+  return length;
 }
 
-// 4 overloaded versions of copyReplaceString() below, from the 2 types of `src`
-// and 2 types of `newString`.
-
-void copyReplaceString(char* dst, size_t dstSize, const char* src,
-    char oldChar, const char* newString) {
+/**
+ * Implementation of copyReplaceString().
+ *
+ * @tparam T cstring-like type, a (const char*) or a FlashStringReader
+ * @tparam N cstring-like type, a (const char*) or a FlashStringReader
+ */
+template <typename T, typename N>
+size_t copyReplaceString(char* dst, size_t dstSize, T src,
+    char oldChar, N newString) {
+  size_t length = 0;
   char c;
-  while ((c = *src++) != '\0' && dstSize > 0) {
+  while ((c = *src++) != '\0') {
     if (c == oldChar) {
-      const char* s = newString;
-      while (*s != '\0' && dstSize > 0) {
-        *dst++ = *s++;
-        dstSize--;
+      N s = newString;
+      while ((c = *s++) != '\0') {
+        if (length + 1 < dstSize) *dst++ = c;
+        length++;
       }
     } else {
-      *dst++ = c;
-      dstSize--;
+      if (length + 1 < dstSize) *dst++ = c;
+      length++;
     }
   }
 
-  if (dstSize == 0) {
-    --dst;
-  }
   *dst = '\0';
+  return length;
 }
 
-void copyReplaceString(char* dst, size_t dstSize, const char* src,
-    char oldChar, const __FlashStringHelper* newString) {
+/**
+ * Implementation of copyReplaceStringLength().
+ *
+ * @tparam T cstring-like type, a (const char*) or a FlashStringReader
+ * @tparam N cstring-like type, a (const char*) or a FlashStringReader
+ */
+template <typename T, typename N>
+size_t copyReplaceStringLength(T src, char oldChar, N newString) {
+  size_t srcLength = 0;
+  size_t count = 0;
   char c;
-  while ((c = *src++) != '\0' && dstSize > 0) {
-    if (c == oldChar) {
-      const char* s = (const char*) newString;
-      while ((char) pgm_read_byte(s) != '\0' && dstSize > 0) {
-        *dst++ = (char) pgm_read_byte(s++);
-        dstSize--;
-      }
-    } else {
-      *dst++ = c;
-      dstSize--;
-    }
+  while ((c = *src++) != '\0') {
+    srcLength++;
+    if (c == oldChar) count++;
   }
+  if (count == 0) return srcLength;
 
-  if (dstSize == 0) {
-    --dst;
-  }
-  *dst = '\0';
+  size_t newLength = 0;
+  while (*newString++ != '\0') newLength++;
+  return srcLength - count + count * newLength;
 }
 
-void copyReplaceString(char* dst, size_t dstSize,
-    const __FlashStringHelper* src, char oldChar, const char* newString) {
-  char c;
-  const char* ss = (const char*) src;
-  while ((c = (char) pgm_read_byte(ss++)) != '\0' && dstSize > 0) {
-    if (c == oldChar) {
-      const char* s = (const char*) newString;
-      while (*s != '\0' && dstSize > 0) {
-        *dst++ = *s++;
-        dstSize--;
-      }
-    } else {
-      *dst++ = c;
-      dstSize--;
-    }
-  }
+}
 
-  if (dstSize == 0) {
-    --dst;
-  }
-  *dst = '\0';
+size_t copyReplaceChar(char* dst, size_t dstSize, const char* src,
+    char oldChar, char newChar) {
+  return internal::copyReplaceChar(dst, dstSize, src, oldChar, newChar);
 }
 
-void copyReplaceString(char* dst, size_t dstSize,
+size_t copyReplaceChar(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, char oldChar, char newChar) {
+  return internal::copyReplaceChar(
+      dst, dstSize, FlashStringReader(src), oldChar, newChar);
+}
+
+size_t copyReplaceString(char* dst, size_t dstSize, const char* src,
+    char oldChar, const char* newString) {
+  return internal::copyReplaceString(dst, dstSize, src, oldChar, newString);
+}
+
+size_t copyReplaceString(char* dst, size_t dstSize, const char* src,
+    char oldChar, const __FlashStringHelper* newString) {
+  return internal::copyReplaceString(
+      dst, dstSize, src, oldChar, FlashStringReader(newString));
+}
+
+size_t copyReplaceString(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, char oldChar, const char* newString) {
+  return internal::copyReplaceString(
+      dst, dstSize, FlashStringReader(src), oldChar, newString);
+}
+
+size_t copyReplaceString(char* dst, size_t dstSize,
     const __FlashStringHelper* src, char oldChar,
     const __FlashStringHelper* newString) {
-  char c;
-  const char* ss = (const char*) src;
-  while ((c = (char) pgm_read_byte(ss++)) != '\0' && dstSize > 0) {
-    if (c == oldChar) {
-      const char* s = (const char*) newString;
-      while ((char) pgm_read_byte(s) != '\0' && dstSize > 0) {
-        *dst++ = (char) pgm_read_byte(s++);
-        dstSize--;
-      }
-    } else {
-      *dst++ = c;
-      dstSize--;
-    }
-  }
+  return internal::copyReplaceString(dst, dstSize,
+      FlashStringReader(src), oldChar, FlashStringReader(newString));
+}
 
-  if (dstSize == 0) {
-    --dst;
-  }
-  *dst = '\0';
+size_t copyReplaceStringLength(const char* src, char oldChar,
+    const char* newString) {
+  return internal::copyReplaceStringLength(src, oldChar, newString);
+}
+
+size_t copyReplaceStringLength(const char* src, char oldChar,
+    const __FlashStringHelper* newString) {
+  return internal::copyReplaceStringLength(
+      src, oldChar, FlashStringReader(newString));
+}
+
+size_t copyReplaceStringLength(const __FlashStringHelper* src, char oldChar,
+    const char* newString) {
+  return internal::copyReplaceStringLength(
+      FlashStringReader(src), oldChar, newString);
+}
+
+size_t copyReplaceStringLength(const __FlashStringHelper* src, char oldChar,
+    const __FlashStringHelper* newString) {
+  return internal::copyReplaceStringLength(
+      FlashStringReader(src), oldChar, FlashStringReader(newString));
+}
+
+size_t copyReplaceChars(char* dst, size_t dstSize, const char* src,
+    const CharReplacer& replacer) {
+  internal::CopyPrint printer(dst, dstSize);
+  printReplaceCharsTo(printer, src, replacer);
+  return printer.terminate();
+}
+
+size_t copyReplaceChars(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, const CharReplacer& replacer) {
+  internal::CopyPrint printer(dst, dstSize);
+  printReplaceCharsTo(printer, src, replacer);
+  return printer.terminate();
+}
+
+size_t copyReplacePatterns(char* dst, size_t dstSize, const char* src,
+    const PatternReplacerBase& replacer) {
+  internal::CopyPrint printer(dst, dstSize);
+  printReplacePatternsTo(printer, src, replacer);
+  return printer.terminate();
+}
+
+size_t copyReplacePatterns(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, const PatternReplacerBase& replacer) {
+  internal::CopyPrint printer(dst, dstSize);
+  printReplacePatternsTo(printer, src, replacer);
+  return printer.terminate();
 }
 
 }
@@ -27,6 +27,13 @@ SOFTWARE.
  *
  * Functions that copy c-strings from `src` to `dst` while replacing a
  * given character with another character or another string.
+ *
+ * Similar to `snprintf()`, each function returns the length of the string
+ * (excluding the terminating NUL) which would have been written if `dst` were
+ * large enough. The result was truncated if the return value is greater than
+ * or equal to `dstSize`. The copyReplaceStringLength() functions calculate the
+ * same length without writing anything, so that `dst` can be allocated with
+ * the exact size.
  */
 
 #ifndef ACE_COMMON_COPY_REPLACE_H
@@ -38,21 +45,28 @@ class __FlashStringHelper;
 
 namespace ace_common {
 
+class CharReplacer;
+class PatternReplacerBase;
+
 /**
  * Copy at most dstSize characters from src to dst, while replacing all
  * occurrences of oldChar with newChar. If newChar is '\0', then replace with
  * nothing. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
  */
-void copyReplaceChar(char* dst, size_t dstSize, const char* src,
+size_t copyReplaceChar(char* dst, size_t dstSize, const char* src,
     char oldChar, char newChar);
 
 /**
  * Copy at most dstSize characters from src to dst, while replacing all
  * occurrences of oldChar with newChar. If newChar is '\0', then replace with
  * nothing. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
  */
-void copyReplaceChar(char* dst, size_t dstSize, const __FlashStringHelper* src,
-    char oldChar, char newChar);
+size_t copyReplaceChar(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, char oldChar, char newChar);
 
 // 4 overloaded versions of copyReplaceString() below, from the 2 types of `src`
 // and 2 types of `newString`.
@@ -61,35 +75,109 @@ void copyReplaceChar(char* dst, size_t dstSize, const __FlashStringHelper* src,
  * Copy at most dstSize characters from src to dst, while replacing all
  * occurrence of oldChar with newString. If newString is "", then replace
  * with nothing. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
  */
-void copyReplaceString(char* dst, size_t dstSize, const char* src,
+size_t copyReplaceString(char* dst, size_t dstSize, const char* src,
     char oldChar, const char* newString);
 
 /**
  * Copy at most dstSize characters from src to dst, while replacing all
  * occurrence of oldChar with newString. If newString is "", then replace
  * with nothing. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
  */
-void copyReplaceString(char* dst, size_t dstSize, const char* src,
+size_t copyReplaceString(char* dst, size_t dstSize, const char* src,
     char oldChar, const __FlashStringHelper* newString);
 
 /**
  * Copy at most dstSize characters from src to dst, while replacing all
  * occurrence of oldChar with newString. If newString is "", then replace
  * with nothing. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
  */
-void copyReplaceString(char* dst, size_t dstSize,
+size_t copyReplaceString(char* dst, size_t dstSize,
     const __FlashStringHelper* src, char oldChar, const char* newString);
 
 /**
  * Copy at most dstSize characters from src to dst, while replacing all
  * occurrence of oldChar with newString. If newString is "", then replace
  * with nothing. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
  */
-void copyReplaceString(char* dst, size_t dstSize,
+size_t copyReplaceString(char* dst, size_t dstSize,
     const __FlashStringHelper* src, char oldChar,
     const __FlashStringHelper* newString);
 
+// 4 overloaded versions of copyReplaceStringLength() below, matching the
+// overloads of copyReplaceString().
+
+/**
+ * Return the length of the string, excluding the NUL terminator, that would
+ * be produced by copyReplaceString() with the same arguments, using a single
+ * pass over `src`. Use the return value + 1 as the `dstSize` to avoid
+ * truncation.
+ */
+size_t copyReplaceStringLength(const char* src, char oldChar,
+    const char* newString);
+
+/** Same as above with `newString` in flash memory. */
+size_t copyReplaceStringLength(const char* src, char oldChar,
+    const __FlashStringHelper* newString);
+
+/** Same as above with `src` in flash memory. */
+size_t copyReplaceStringLength(const __FlashStringHelper* src, char oldChar,
+    const char* newString);
+
+/** Same as above with `src` and `newString` in flash memory. */
+size_t copyReplaceStringLength(const __FlashStringHelper* src, char oldChar,
+    const __FlashStringHelper* newString);
+
+/**
+ * Copy at most dstSize characters from src to dst, while replacing every
+ * character found in the `replacer` with its replacement string, in a single
+ * pass over `src`. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
+ */
+size_t copyReplaceChars(char* dst, size_t dstSize, const char* src,
+    const CharReplacer& replacer);
+
+/**
+ * Copy at most dstSize characters from src to dst, while replacing every
+ * character found in the `replacer` with its replacement string, in a single
+ * pass over `src`. The resulting dst string is always NUL terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
+ */
+size_t copyReplaceChars(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, const CharReplacer& replacer);
+
+/**
+ * Copy at most dstSize characters from src to dst, while replacing every
+ * occurrence of the patterns in the `replacer` with their replacement strings,
+ * in a single pass over `src`. The resulting dst string is always NUL
+ * terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
+ */
+size_t copyReplacePatterns(char* dst, size_t dstSize, const char* src,
+    const PatternReplacerBase& replacer);
+
+/**
+ * Copy at most dstSize characters from src to dst, while replacing every
+ * occurrence of the patterns in the `replacer` with their replacement strings,
+ * in a single pass over `src`. The resulting dst string is always NUL
+ * terminated.
+ *
+ * @return length of the untruncated result, excluding the NUL terminator
+ */
+size_t copyReplacePatterns(char* dst, size_t dstSize,
+    const __FlashStringHelper* src, const PatternReplacerBase& replacer);
+
 } // ace_common
 
 #endif
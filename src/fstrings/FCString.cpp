@@ -28,6 +28,7 @@ SOFTWARE.
 #include <stdint.h> // uintptr_t
 #include <string.h> // strcmp()
 #include <Print.h> // Print
+#include "FlashStringReader.h"
 #include "FCString.h"
 
 namespace ace_common {
@@ -37,11 +38,15 @@ size_t FCString::printTo(Print& printer) const {
     return printer.print((uintptr_t) this);
   }
 
+#if ACE_COMMON_UNIFIED_FLASH
+  return printer.print(getCString());
+#else
   if (mStringType == kCStringType) {
     return printer.print(getCString());
   } else {
     return printer.print(getFString());
   }
+#endif
 }
 
 namespace internal {
@@ -53,6 +58,9 @@ int compareString(const char* a, const char* b) {
   return strcmp(a, b);
 }
 
+// Not needed if ACE_COMMON_UNIFIED_FLASH, see FCString::compareTo().
+#if ! ACE_COMMON_UNIFIED_FLASH
+
 int compareString(const char* a, const __FlashStringHelper* b) {
   if (a == (const char*) b) { return 0; }
   if (a == nullptr) { return -1; }
@@ -68,22 +76,25 @@ int compareString(const __FlashStringHelper* a, const __FlashStringHelper* b) {
   if (a == b) { return 0; }
   if (a == nullptr) { return -1; }
   if (b == nullptr) { return 1; }
-  const char* aa = reinterpret_cast<const char*>(a);
-  const char* bb = reinterpret_cast<const char*>(b);
-
+  FlashStringReader aa(a);
+  FlashStringReader bb(b);
   while (true) {
-    uint8_t ca = pgm_read_byte(aa);
-    uint8_t cb = pgm_read_byte(bb);
+    uint8_t ca = *aa++;
+    uint8_t cb = *bb++;
     if (ca != cb) return (int) ca - (int) cb;
     if (ca == '\0') return 0;
-    aa++;
-    bb++;
   }
 }
 
+#endif
+
 }
 
 int FCString::compareTo(const FCString& that) const {
+#if ACE_COMMON_UNIFIED_FLASH
+  // The f-string is a normal pointer, so use the strcmp() of the C library.
+  return internal::compareString(getCString(), that.getCString());
+#else
   if (getType() == FCString::kCStringType) {
       if (that.getType() == FCString::kCStringType) {
         return internal::compareString(getCString(), that.getCString());
@@ -97,6 +108,7 @@ int FCString::compareTo(const FCString& that) const {
         return internal::compareString(getFString(), that.getFString());
       }
   }
+#endif
 }
 
 }
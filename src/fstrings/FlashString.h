@@ -27,6 +27,30 @@ SOFTWARE.
 
 #include <Arduino.h>
 
+// Set to 1 on the processors where the flash memory is mapped into the same
+// address space as the RAM, so that `pgm_read_byte(p)` is just `*p` and an
+// f-string is an ordinary `const char*` (e.g. ESP32, SAMD, STM32, RP2040,
+// Teensy 3 and 4). The functions which take a `const __FlashStringHelper*`
+// then forward to their `const char*` versions, which use the `<string.h>`
+// functions of the C library and share the same template instances. Set to 0
+// on the AVR, which has a separate address space for the flash, and on the
+// ESP8266, whose flash must be read in aligned 32-bit words. EpoxyDuino also
+// defaults to 0, so that its unit tests exercise the flash string code paths
+// of the AVR and ESP8266. Define it to 1 on the command line to test the
+// unified code paths instead.
+#ifndef ACE_COMMON_UNIFIED_FLASH
+  #if defined(ESP32) \
+      || defined(ARDUINO_ARCH_SAMD) \
+      || defined(ARDUINO_ARCH_SAM) \
+      || defined(ARDUINO_ARCH_STM32) \
+      || defined(ARDUINO_ARCH_RP2040) \
+      || (defined(TEENSYDUINO) && ! defined(__AVR__))
+    #define ACE_COMMON_UNIFIED_FLASH 1
+  #else
+    #define ACE_COMMON_UNIFIED_FLASH 0
+  #endif
+#endif
+
 namespace ace_common {
 
 /**
@@ -113,6 +137,12 @@ class FlashString {
       return (const __FlashStringHelper*) fsp--;
     }
 
+    /** Advance by `n` characters. */
+    FlashString& operator+=(size_t n) {
+      fsp += n;
+      return *this;
+    }
+
   private:
 
     const char* fsp;
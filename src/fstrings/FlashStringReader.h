@@ -0,0 +1,226 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file FlashStringReader.h
+ *
+ * A version of FlashString which reads the flash memory in aligned blocks of
+ * 4 to 32 bytes, instead of one byte at a time, for the processors where a
+ * byte read from flash is much slower than a word read (e.g. ESP8266).
+ */
+
+#ifndef ACE_COMMON_FLASH_STRING_READER_H
+#define ACE_COMMON_FLASH_STRING_READER_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uintptr_t, uint32_t
+#include <Arduino.h> // pgm_read_byte(), pgm_read_dword()
+#include "../optimize/optimize.h"
+#include "FlashString.h"
+
+// Size of the RAM window of the FlashStringReader, in bytes. Defaults to 4 on
+// the ESP8266, whose flash can only be read in aligned 32-bit words. A value
+// of 0 makes FlashStringReader the same as FlashString (or a plain `const
+// char*` if ACE_COMMON_UNIFIED_FLASH), which is better on the processors where
+// a byte read from flash is as fast as a byte read from RAM, and when
+// optimizing for size.
+#ifndef ACE_COMMON_FLASH_READER_BLOCK_SIZE
+  #if defined(ESP8266) && ! defined(ACE_COMMON_OPTIMIZE_SIZE)
+    #define ACE_COMMON_FLASH_READER_BLOCK_SIZE 4
+  #else
+    #define ACE_COMMON_FLASH_READER_BLOCK_SIZE 0
+  #endif
+#endif
+
+// The window may extend past the end of a string in flash. That is harmless
+// on the microcontrollers, but AddressSanitizer reports it on the host.
+#if defined(__SANITIZE_ADDRESS__)
+  #define ACE_COMMON_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#elif defined(__has_feature)
+  #if __has_feature(address_sanitizer)
+    #define ACE_COMMON_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+  #endif
+#endif
+#ifndef ACE_COMMON_NO_SANITIZE_ADDRESS
+  #define ACE_COMMON_NO_SANITIZE_ADDRESS
+#endif
+
+namespace ace_common {
+
+/**
+ * A drop-in replacement of FlashString for the template functions which read
+ * a flash string from beginning to end (e.g. hashDjb2Template(),
+ * copyReplaceString()). The first dereference of a character copies the
+ * aligned block of `BlockSize` bytes which contains it into a small RAM
+ * window, using `pgm_read_dword()` on each 32-bit word. The following
+ * characters of the same block are read from the window.
+ *
+ * The block is aligned, so it never crosses a page of the flash memory, but it
+ * may contain a few bytes past the terminating NUL of the string, which are
+ * read but ignored.
+ *
+ * The post-increment and post-decrement operators return a small object which
+ * holds the previous character, so that the common `*s++` idiom does not copy
+ * the window. That object supports only the dereference operator.
+ *
+ * @tparam BlockSize size of the RAM window, a power of 2 between 4 and 32
+ */
+template <uint8_t BlockSize>
+class FlashStringReaderT {
+  static_assert(BlockSize >= 4 && BlockSize <= 32
+      && (BlockSize & (BlockSize - 1)) == 0,
+      "BlockSize must be 4, 8, 16 or 32");
+
+  public:
+    /** The character before an increment or decrement. */
+    class Previous {
+      public:
+        explicit Previous(char c) : mChar(c) {}
+
+        /** Return the character before the increment or decrement. */
+        char operator*() const { return mChar; }
+
+      private:
+        char mChar;
+    };
+
+    /** Constructor, with implicit conversion, like FlashString. */
+    FlashStringReaderT(const __FlashStringHelper* p) :
+        mPtr((const char*) p),
+        // Any value greater than mPtr marks the window as empty.
+        mBlock((uintptr_t) mPtr + 1)
+    {}
+
+    /** Dereference operator. Fills the window if necessary. */
+    char operator*() const {
+      uintptr_t offset = (uintptr_t) mPtr - mBlock;
+      if (offset >= BlockSize) {
+        fill();
+        offset = (uintptr_t) mPtr - mBlock;
+      }
+      return mWindow.bytes[offset];
+    }
+
+    /** Array dereference operator, which bypasses the window. */
+    char operator[](size_t i) const {
+      return (char) pgm_read_byte(mPtr + i);
+    }
+
+    /** Implicit cast to `const void*`, same as FlashString. */
+    operator const void*() const {
+      return (const void*) mPtr;
+    }
+
+    /** Retrieve the original pointer with an explicit cast. */
+    explicit operator const __FlashStringHelper*() const {
+      return (const __FlashStringHelper*) mPtr;
+    }
+
+    /** Pre-increment. */
+    FlashStringReaderT& operator++() {
+      ++mPtr;
+      return *this;
+    }
+
+    /** Post-increment, returning the previous character. */
+    Previous operator++(int) {
+      char c = **this;
+      ++mPtr;
+      return Previous(c);
+    }
+
+    /** Pre-decrement. */
+    FlashStringReaderT& operator--() {
+      --mPtr;
+      return *this;
+    }
+
+    /** Post-decrement, returning the previous character. */
+    Previous operator--(int) {
+      char c = **this;
+      --mPtr;
+      return Previous(c);
+    }
+
+    /** Advance by `n` characters. */
+    FlashStringReaderT& operator+=(size_t n) {
+      mPtr += n;
+      return *this;
+    }
+
+  private:
+    /**
+     * Copy the aligned block which contains mPtr into the window, one 32-bit
+     * word at a time.
+     */
+    ACE_COMMON_NO_SANITIZE_ADDRESS
+    void fill() const {
+      mBlock = (uintptr_t) mPtr & ~(uintptr_t) (BlockSize - 1);
+      for (uint8_t i = 0; i < BlockSize / 4; i++) {
+        mWindow.words[i] = pgm_read_dword((const uint32_t*) mBlock + i);
+      }
+    }
+
+    /** Current position in flash. */
+    const char* mPtr;
+
+    /** Address of the block in the window. */
+    mutable uintptr_t mBlock;
+
+    /** Copy of the block, aligned for pgm_read_dword(). */
+    mutable union {
+      uint32_t words[BlockSize / 4];
+      char bytes[BlockSize];
+    } mWindow;
+};
+
+#if ACE_COMMON_FLASH_READER_BLOCK_SIZE > 0
+
+/**
+ * The reader used by the library functions which scan a flash string, with a
+ * window of ACE_COMMON_FLASH_READER_BLOCK_SIZE bytes.
+ */
+typedef FlashStringReaderT<ACE_COMMON_FLASH_READER_BLOCK_SIZE>
+    FlashStringReader;
+
+#elif ACE_COMMON_UNIFIED_FLASH
+
+/**
+ * The reader is a plain `const char*` when the flash memory is in the same
+ * address space as the RAM, so that the template functions called with a
+ * FlashStringReader are the same instances as those called with a c-string.
+ * Create it with a cast, e.g. `FlashStringReader(fs)`.
+ */
+typedef const char* FlashStringReader;
+
+#else
+
+/** The reader is a plain FlashString when the block size is 0. */
+typedef FlashString FlashStringReader;
+
+#endif
+
+} // ace_common
+
+#endif
@@ -33,7 +33,7 @@ SOFTWARE.
 #define ACE_COMMON_HASH_DJB2_H
 
 #include <stdint.h> // uint32_t
-#include "../fstrings/FlashString.h"
+#include "../fstrings/FlashStringReader.h"
 class __FlashStringHelper;
 
 namespace ace_common {
@@ -75,7 +75,7 @@ inline uint32_t hashDjb2(const char* s) { return hashDjb2Template(s); }
  * @param fs NUL terminated string stored in Flash memory, cannot be nullptr
  */
 inline uint32_t hashDjb2(const __FlashStringHelper* fs) {
-  return hashDjb2Template<FlashString>(FlashString(fs));
+  return hashDjb2Template<FlashStringReader>(FlashStringReader(fs));
 }
 
 } // ace_common
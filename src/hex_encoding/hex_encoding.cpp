@@ -0,0 +1,192 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <Arduino.h> // PROGMEM, pgm_read_byte()
+#include <Print.h>
+#include "hex_encoding.h"
+
+namespace ace_common {
+
+namespace internal {
+
+/** Hexadecimal characters using uppercase letters. */
+static const char kHexUpper[16] PROGMEM = {
+  '0', '1', '2', '3', '4', '5', '6', '7',
+  '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+};
+
+/** Hexadecimal characters using lowercase letters. */
+static const char kHexLower[16] PROGMEM = {
+  '0', '1', '2', '3', '4', '5', '6', '7',
+  '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+};
+
+#if ACE_COMMON_HEX_DECODE_TABLE
+
+/**
+ * Map of characters to their hexadecimal value. Invalid characters map to
+ * 0xFF. This costs 256 bytes of flash, but allows decoding and
+ * validation to be done with a single lookup, without any branches.
+ */
+const uint8_t kHexValues[256] PROGMEM = {
+  // 0x00 - 0x2F
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  // 0x30 - 0x3F: '0' - '9'
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  // 0x40 - 0x5F: 'A' - 'F'
+  0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  // 0x60 - 0x7F: 'a' - 'f'
+  0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  // 0x80 - 0xFF
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+#endif
+
+/** Return the table of hex characters selected by baseChar. */
+static inline const char* hexTable(char baseChar) {
+  return (baseChar == 'a') ? kHexLower : kHexUpper;
+}
+
+} // internal
+
+uint8_t hexEncode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written, char baseChar) {
+  const char* const table = internal::hexTable(baseChar);
+
+  // Number of bytes which fit completely into 't', leaving room for the NUL.
+  size_t count = (tcap > 0) ? (tcap - 1) / 2 : 0;
+  uint8_t status = 0;
+  if (count < n) {
+    status = 1;
+  } else {
+    count = n;
+  }
+
+  char* tt = t;
+  for (size_t i = 0; i < count; i++) {
+    uint8_t c = s[i];
+    tt[0] = (char) pgm_read_byte(&table[c >> 4]);
+    tt[1] = (char) pgm_read_byte(&table[c & 0xf]);
+    tt += 2;
+  }
+
+  if (tcap > 0) *tt = '\0';
+  if (written) {
+    *written = tt - t;
+  }
+  return status;
+}
+
+uint8_t hexDecode(uint8_t* t, size_t tcap, const char* s, size_t* written) {
+  uint8_t* tt = t;
+  uint8_t* const tend = t + tcap;
+
+  // The code becomes smaller if we assume an error status as the default.
+  uint8_t status = 2;
+
+  while (true) {
+    uint8_t high = *s++;
+    if (high == '\0') {
+      status = 0;
+      break;
+    }
+    uint8_t low = *s++;
+    if (low == '\0') break;
+
+    // Valid values are 0-15, so a single check on the upper nibble catches an
+    // invalid character in either position.
+    uint8_t h = internal::hexValue(high);
+    uint8_t l = internal::hexValue(low);
+    if ((h | l) & 0xF0) break;
+
+    if (tt >= tend) {
+      status = 1;
+      break;
+    }
+    *tt++ = (h << 4) | l;
+  }
+
+  if (written) {
+    *written = tt - t;
+  }
+  return status;
+}
+
+size_t printHexTo(Print& printer, const void* s, size_t n, char baseChar) {
+  const char* const table = internal::hexTable(baseChar);
+  const uint8_t* ss = (const uint8_t*) s;
+
+  // Small enough to fit on the stack of an 8-bit processor.
+  const uint8_t kBufSize = 32;
+  char buf[kBufSize];
+
+  size_t total = 0;
+  while (n > 0) {
+    size_t count = (n < kBufSize / 2) ? n : kBufSize / 2;
+    char* b = buf;
+    for (size_t i = 0; i < count; i++) {
+      uint8_t c = *ss++;
+      b[0] = (char) pgm_read_byte(&table[c >> 4]);
+      b[1] = (char) pgm_read_byte(&table[c & 0xf]);
+      b += 2;
+    }
+    n -= count;
+
+    size_t len = b - buf;
+    size_t w = printer.write((const uint8_t*) buf, len);
+    total += w;
+    if (w < len) break;
+  }
+  return total;
+}
+
+}
@@ -0,0 +1,137 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file hex_encoding.h
+ *
+ * Provides functions to convert an array of bytes into a string of
+ * hexadecimal characters and back again, and to print an array of bytes as
+ * hexadecimal characters to a `Print` object. These are bulk versions of the
+ * single-byte byteToHexChar() and hexCharToByte() functions in url_encoding.h,
+ * using lookup tables in flash memory instead of branches.
+ */
+
+#ifndef ACE_COMMON_HEX_ENCODING_H
+#define ACE_COMMON_HEX_ENCODING_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+#include <Arduino.h> // PROGMEM, pgm_read_byte()
+#include "../optimize/optimize.h"
+
+// Decode the hex characters using a table of 256 bytes in flash, instead of a
+// few comparisons, unless optimizing for size.
+#ifndef ACE_COMMON_HEX_DECODE_TABLE
+  #if defined(ACE_COMMON_OPTIMIZE_SIZE)
+    #define ACE_COMMON_HEX_DECODE_TABLE 0
+  #else
+    #define ACE_COMMON_HEX_DECODE_TABLE 1
+  #endif
+#endif
+
+class Print;
+
+namespace ace_common {
+
+namespace internal {
+
+#if ACE_COMMON_HEX_DECODE_TABLE
+
+/** Map of characters to their hexadecimal value, 0xFF if invalid. */
+extern const uint8_t kHexValues[256] PROGMEM;
+
+/**
+ * Return the value (0-15) of the hexadecimal character `c`, or 0xFF if `c` is
+ * not a hexadecimal character.
+ */
+inline uint8_t hexValue(uint8_t c) {
+  return pgm_read_byte(&kHexValues[c]);
+}
+
+#else
+
+/** Same as the table version of hexValue(), using comparisons. */
+inline uint8_t hexValue(uint8_t c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  c |= 0x20; // lowercase
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return 0xFF;
+}
+
+#endif
+
+} // internal
+
+/**
+ * Encode the `n` bytes in `s` into 2*n hexadecimal characters in the target
+ * string `t` with capacity `tcap`. The target `t` is always NUL-terminated, so
+ * `tcap` must be at least `2*n+1` to hold the entire result. If `t` runs out of
+ * capacity, only the bytes which fit completely (i.e. both characters) are
+ * written.
+ *
+ * @param t target c-string
+ * @param tcap capacity of t
+ * @param s source array of bytes
+ * @param n number of bytes in s
+ * @param written (nullable) the number of characters written to 't'
+ * @param baseChar the base character of the hexadecimal range, default 'A'
+ *   which produces uppercase characters. Set this to 'a' to get lowercase
+ *   characters.
+ * @return 0 status if successful, 1 if 't' ran out of capacity
+ */
+uint8_t hexEncode(char* t, size_t tcap, const uint8_t* s, size_t n,
+    size_t* written, char baseChar = 'A');
+
+/**
+ * Decode the NUL-terminated hexadecimal string `s` into bytes in `t` with
+ * capacity `tcap`. Both uppercase and lowercase hex characters are accepted.
+ * The target `t` is an array of bytes and is *not* NUL-terminated.
+ *
+ * @param t target array of bytes
+ * @param tcap capacity of t
+ * @param s source c-string containing pairs of hex characters
+ * @param written (nullable) the number of bytes written to 't'
+ * @return 0 status if successful; 1 if 't' ran out of capacity; 2 if 's' was
+ *    ill-formed (e.g. an odd number of characters, or a non-hex character)
+ */
+uint8_t hexDecode(uint8_t* t, size_t tcap, const char* s, size_t* written);
+
+/**
+ * Print the `n` bytes in `s` as 2*n hexadecimal characters to the `printer`.
+ * The characters are collected in a small buffer on the stack and sent to the
+ * printer in blocks using `Print::write(buf, size)`, instead of one call to
+ * `Print::write(c)` per character.
+ *
+ * @param printer destination of the hex characters
+ * @param s source array of bytes
+ * @param n number of bytes in s
+ * @param baseChar 'A' for uppercase (default), 'a' for lowercase
+ * @return number of characters written to `printer`
+ */
+size_t printHexTo(Print& printer, const void* s, size_t n,
+    char baseChar = 'A');
+
+}
+
+#endif
@@ -23,7 +23,7 @@ int KString::compareTo(const char* s) {
     // difference in performance. I think this is because there is enough
     // overhead in the rest of function to make this conditional code
     // unimportant.
-    uint8_t ca = (stringType_ == kTypeCstring) ? *a : pgm_read_byte(a);
+    uint8_t ca = isCstring(stringType_) ? *a : pgm_read_byte(a);
 
     if (ca != cb) {
       // If ca is a keyword reference, then compare against the keyword.
@@ -33,7 +33,7 @@ int KString::compareTo(const char* s) {
         KStringKeywords keywords(keywordType_, keywords_);
         const char* k = keywords.get(ca);
         while (true) {
-          ca = (keywordType_ == kTypeCstring) ? *k : pgm_read_byte(k);
+          ca = isCstring(keywordType_) ? *k : pgm_read_byte(k);
           cb = *b;
           if (ca == '\0') {
             a++;
@@ -90,12 +90,12 @@ void KString::printTo(Print& printer) {
     // usually not good for performance. But the templatized version of
     // compareTo() made no difference, and this function which outputs to a
     // Printer is not expected to be in a performance critical section.
-    char c = (stringType_ == kTypeCstring) ? *s : pgm_read_byte(s);
+    char c = isCstring(stringType_) ? *s : pgm_read_byte(s);
 
     s++;
     if (c == 0) break;
     if (c < numKeywords_) {
-      if (keywordType_ == kTypeCstring) {
+      if (isCstring(keywordType_)) {
         printer.print((const char*) keywords_[(uint8_t) c]);
       } else {
         printer.print((const __FlashStringHelper*)
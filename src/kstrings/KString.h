@@ -26,6 +26,7 @@ SOFTWARE.
 #define ACE_COMMON_KSTRING_H
 
 #include <stdint.h> // int8_t
+#include "../fstrings/FlashString.h" // ACE_COMMON_UNIFIED_FLASH
 class __FlashStringHelper;
 class Print;
 
@@ -178,6 +179,15 @@ class KString {
     static const uint8_t kTypeCstring = 0;
     static const uint8_t kTypeFstring = 1;
 
+    /**
+     * Return true if a string of the given type can be read through a normal
+     * pointer. Always true if ACE_COMMON_UNIFIED_FLASH, which allows the
+     * compiler to remove the branches which call pgm_read_byte().
+     */
+    static bool isCstring(uint8_t type) {
+      return ACE_COMMON_UNIFIED_FLASH || type == kTypeCstring;
+    }
+
     // The order of the following fields is deliberate to reduce the memory
     // size of this class on 32-bit processors.
     const void* const string_;
@@ -222,7 +232,7 @@ class KStringIterator {
 
   private:
     static char getInternal(uint8_t type, const char* p) {
-      return (type == KString::kTypeCstring) ? *p : pgm_read_byte(p);
+      return KString::isCstring(type) ? *p : pgm_read_byte(p);
     }
 
   private:
@@ -258,7 +268,7 @@ class KStringKeywords {
      * constructor.
      */
     const char* get(uint8_t i) const {
-      if (type_ == KString::kTypeCstring) {
+      if (KString::isCstring(type_)) {
         auto words = (const char* const*) keywords_;
         return words[i];
       } else {
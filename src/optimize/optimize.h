@@ -0,0 +1,71 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file optimize.h
+ *
+ * Library-wide selection between the size-optimized and the speed-optimized
+ * implementations of the functions which have both. Define one of the
+ * following macros on the compiler command line (e.g. using the
+ * `build_flags` of PlatformIO, the `EXTRA_CPPFLAGS` of EpoxyDuino, or a
+ * `platform.local.txt` file of the Arduino IDE), so that the library sources
+ * see the same value:
+ *
+ *  * `ACE_COMMON_OPTIMIZE_SIZE`: use the compact loops, without the lookup
+ *    tables in flash memory, for a small microcontroller (e.g. an AVR with 32
+ *    kB of flash).
+ *  * `ACE_COMMON_OPTIMIZE_SPEED`: use the table-driven and wider kernels
+ *    everywhere, for a processor with plenty of flash (e.g. ESP32 or Linux).
+ *
+ * If neither is defined, each module selects the implementation which was
+ * determined to be the better default for the target platform.
+ *
+ * Each module derives its own configuration macro from this policy, which can
+ * also be set individually to override the policy:
+ *
+ *  * `ACE_COMMON_HEX_DECODE_TABLE` (hex_encoding.h): 256-byte table used by
+ *    hexDecode(), 1 unless optimizing for size.
+ *  * `ACE_COMMON_HEX_CHAR_TABLE` (url_encoding.h): use the same table in
+ *    hexCharToByte() and backslashXDecode(), 1 only when optimizing for speed.
+ *  * `ACE_COMMON_FORMAT_DIGIT_PAIRS` (formatUint.cpp): 200-byte table of
+ *    digit pairs used by formatUint(), 1 unless optimizing for size.
+ *  * `ACE_COMMON_PARSE_SWAR` (parseInt.h): 8 digits at a time in parseUint(),
+ *    0 when optimizing for size, otherwise 1 on 32-bit and 64-bit
+ *    little-endian processors.
+ *  * `ACE_COMMON_FLASH_READER_BLOCK_SIZE` (FlashStringReader.h): size of the
+ *    RAM window used to scan flash strings, 4 on the ESP8266 unless
+ *    optimizing for size, otherwise 0.
+ *  * `ACE_COMMON_FLOAT_COMPACT_TABLES` (printFloatTo.cpp): compact tables of
+ *    powers of 5 for printFloatTo(double), 1 when optimizing for size, 0 when
+ *    optimizing for speed, otherwise 1 except on Linux, MacOS and Windows.
+ */
+
+#ifndef ACE_COMMON_OPTIMIZE_H
+#define ACE_COMMON_OPTIMIZE_H
+
+#if defined(ACE_COMMON_OPTIMIZE_SIZE) && defined(ACE_COMMON_OPTIMIZE_SPEED)
+  #error Only one of ACE_COMMON_OPTIMIZE_SIZE or _SPEED may be defined
+#endif
+
+#endif
@@ -0,0 +1,354 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file parseInt.h
+ *
+ * Functions that parse decimal integers and fixed point numbers from a
+ * `const char*` or a `const __FlashStringHelper*` string of a given length.
+ * These are the inverse of printPadTo() and printFixedPointTo(). Unlike
+ * `atoi()` and `strtol()`, they do not depend on the locale, they accept
+ * strings in flash memory, and they detect overflow of the destination type.
+ *
+ * On 32-bit and 64-bit little-endian processors, runs of 8 digits are
+ * validated and converted using SWAR (SIMD within a register) operations on a
+ * 64-bit integer, instead of one digit at a time.
+ */
+
+#ifndef ACE_COMMON_PARSE_INT_H
+#define ACE_COMMON_PARSE_INT_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t, UINTPTR_MAX
+#include <string.h> // memcpy()
+#include <Arduino.h> // memcpy_P()
+#include "../fstrings/FlashString.h"
+#include "../optimize/optimize.h"
+#include "../print_utils/formatUint.h" // UnsignedOf, pow10()
+
+// Enable the 8-digit SWAR parser on 32-bit and 64-bit little-endian
+// processors, unless optimizing for size. On 8-bit processors, the 64-bit
+// multiplications are slower than the simple loop.
+#ifndef ACE_COMMON_PARSE_SWAR
+  #if defined(ACE_COMMON_OPTIMIZE_SIZE)
+    #define ACE_COMMON_PARSE_SWAR 0
+  #elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ \
+      && UINTPTR_MAX > 0xFFFF
+    #define ACE_COMMON_PARSE_SWAR 1
+  #else
+    #define ACE_COMMON_PARSE_SWAR 0
+  #endif
+#endif
+
+namespace ace_common {
+
+namespace internal {
+
+/** Load 8 characters from `s` into `chunk`, the first one in the low byte. */
+inline void loadChunk(const char* s, uint64_t& chunk) {
+  memcpy(&chunk, s, sizeof(chunk));
+}
+
+/** Same as loadChunk(const char*, uint64_t&) for a FlashString. */
+inline void loadChunk(FlashString s, uint64_t& chunk) {
+  memcpy_P(&chunk, (const char*) (const __FlashStringHelper*) s,
+      sizeof(chunk));
+}
+
+/** Return true if all 8 bytes of `chunk` are the ASCII digits '0' to '9'. */
+inline bool isEightDigits(uint64_t chunk) {
+  // High nibble must be 3, and adding 6 to the low nibble must not carry.
+  return ((chunk & 0xF0F0F0F0F0F0F0F0ULL)
+      | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+      == 0x3333333333333333ULL;
+}
+
+/**
+ * Convert the 8 ASCII digits in `chunk` (validated by isEightDigits()) into
+ * the number 0 to 99999999, by combining adjacent digits into pairs, then
+ * pairs into groups of 4, then into 8, using 3 multiplications.
+ */
+inline uint32_t parseEightDigits(uint64_t chunk) {
+  chunk &= 0x0F0F0F0F0F0F0F0FULL;
+  chunk = (chunk * ((10 << 8) + 1)) >> 8;
+  chunk = ((chunk & 0x00FF00FF00FF00FFULL) * ((100ULL << 16) + 1)) >> 16;
+  return (uint32_t) (((chunk & 0x0000FFFF0000FFFFULL)
+      * ((10000ULL << 32) + 1)) >> 32);
+}
+
+/**
+ * Parse the run of decimal digits at the start of the `len` characters of `s`
+ * into the unsigned `value`. Returns the number of digits consumed, which is
+ * 0 if `s` does not start with a digit. Sets `overflow` and stops if the value
+ * becomes larger than `max`.
+ *
+ * @tparam U unsigned integer type of the value
+ * @tparam S `const char*` or FlashString
+ */
+template <typename U, typename S>
+size_t parseDigits(S s, size_t len, U max, U& value, bool& overflow) {
+  const U maxDiv10 = max / 10;
+  U v = 0;
+  size_t i = 0;
+  overflow = false;
+
+#if ACE_COMMON_PARSE_SWAR
+  // 99999999 requires at least 27 bits.
+  if (sizeof(U) >= sizeof(uint32_t)) {
+    const U maxDiv1e8 = max / 100000000;
+    while (len - i >= 8) {
+      uint64_t chunk;
+      loadChunk(s, chunk);
+      if (! isEightDigits(chunk)) break;
+      uint32_t d = parseEightDigits(chunk);
+      // Let the loop below handle the digits which overflow.
+      if (v > maxDiv1e8) break;
+      U scaled = v * 100000000;
+      if (d > max - scaled) break;
+      v = scaled + d;
+      s += 8;
+      i += 8;
+    }
+  }
+#endif
+
+  for (; i < len; i++) {
+    uint8_t d = (uint8_t) (*s - '0');
+    if (d > 9) break;
+    if (v > maxDiv10) {
+      overflow = true;
+      return i;
+    }
+    U scaled = v * 10;
+    if (d > max - scaled) {
+      overflow = true;
+      return i;
+    }
+    v = scaled + d;
+    ++s;
+  }
+
+  value = v;
+  return i;
+}
+
+/** Implementation of parseUint() for `const char*` or FlashString. */
+template <typename T, typename S>
+size_t parseUintT(S s, size_t len, T& value) {
+  static_assert((T) -1 > (T) 0, "T must be unsigned");
+  T v;
+  bool overflow;
+  size_t n = parseDigits(s, len, (T) -1, v, overflow);
+  if (n == 0 || overflow) return 0;
+  value = v;
+  return n;
+}
+
+/**
+ * Parse the optional sign at the start of `s`. Returns the number of
+ * characters consumed (0 or 1), and sets `negative`. Returns 0 if the first
+ * character is neither '+' nor '-'.
+ */
+template <typename S>
+size_t parseSign(S s, size_t len, bool& negative) {
+  negative = false;
+  if (len == 0) return 0;
+  char c = *s;
+  if (c == '-') {
+    negative = true;
+    return 1;
+  }
+  return (c == '+') ? 1 : 0;
+}
+
+/**
+ * Return the largest magnitude of a number of the integer type T, with the
+ * given sign, as its unsigned type. Returns 0 for a negative unsigned type,
+ * so that only "-0" is accepted.
+ */
+template <typename T>
+typename UnsignedOf<T>::type maxMagnitude(bool negative) {
+  typedef typename UnsignedOf<T>::type U;
+  const bool isSigned = (T) -1 < (T) 0;
+  if (! isSigned) return negative ? 0 : (U) -1;
+  const U maxPositive = (U) -1 >> 1;
+  return negative ? maxPositive + 1 : maxPositive;
+}
+
+/** Implementation of parseInt() for `const char*` or FlashString. */
+template <typename T, typename S>
+size_t parseIntT(S s, size_t len, T& value) {
+  typedef typename UnsignedOf<T>::type U;
+
+  bool negative;
+  size_t n = parseSign(s, len, negative);
+  s += n;
+
+  U magnitude;
+  bool overflow;
+  size_t digits = parseDigits(s, len - n, maxMagnitude<T>(negative),
+      magnitude, overflow);
+  if (digits == 0 || overflow) return 0;
+
+  value = (T) (negative ? (U) (U(0) - magnitude) : magnitude);
+  return n + digits;
+}
+
+/** Implementation of parseFixedPoint() for `const char*` or FlashString. */
+template <uint8_t Decimals, typename T, typename S>
+size_t parseFixedPointT(S s, size_t len, T& value) {
+  static_assert(Decimals <= 19, "Decimals must be <= 19");
+  typedef typename UnsignedOf<T>::type U;
+
+  bool negative;
+  size_t n = parseSign(s, len, negative);
+  s += n;
+  const U max = maxMagnitude<T>(negative);
+
+  // Whole part, which may be absent (e.g. ".5").
+  U whole;
+  bool overflow;
+  size_t wholeDigits = parseDigits(s, len - n, max, whole, overflow);
+  if (overflow) return 0;
+  s += wholeDigits;
+  n += wholeDigits;
+
+  // Fractional part, padded with zeros or truncated to Decimals digits.
+  uint64_t frac = 0;
+  size_t fracDigits = 0;
+  if (n < len && *s == '.') {
+    ++s;
+    n++;
+    for (; n < len; n++, ++s) {
+      uint8_t d = (uint8_t) (*s - '0');
+      if (d > 9) break;
+      if (fracDigits < Decimals) frac = frac * 10 + d;
+      fracDigits++;
+    }
+  }
+  if (wholeDigits == 0 && fracDigits == 0) return 0;
+  for (size_t i = fracDigits; i < Decimals; i++) frac *= 10;
+
+  // Combine whole * 10^Decimals + frac, checking for overflow. If 10^Decimals
+  // does not fit into U, the whole part must be 0.
+  if (frac > max) return 0;
+  const uint64_t kMultiplier = pow10(Decimals);
+  U magnitude;
+  if (kMultiplier > (U) -1) {
+    if (whole != 0) return 0;
+    magnitude = (U) frac;
+  } else {
+    if (whole > max / (U) kMultiplier) return 0;
+    U scaled = whole * (U) kMultiplier;
+    if (scaled > max - (U) frac) return 0;
+    magnitude = scaled + frac;
+  }
+
+  value = (T) (negative ? (U) (U(0) - magnitude) : magnitude);
+  return n;
+}
+
+}
+
+/**
+ * Parse the unsigned decimal integer at the start of the first `len`
+ * characters of `s` into `value`. Parsing stops at the first character which
+ * is not a digit. Leading whitespace and signs are not accepted.
+ *
+ * @tparam T unsigned integer type, up to 64 bits
+ * @return the number of characters consumed, or 0 if `s` does not start with
+ *    a digit or if the number does not fit into T, in which case `value` is
+ *    unchanged
+ */
+template <typename T>
+size_t parseUint(const char* s, size_t len, T& value) {
+  return internal::parseUintT(s, len, value);
+}
+
+/** Same as parseUint(const char*, size_t, T&) for a flash string. */
+template <typename T>
+size_t parseUint(const __FlashStringHelper* s, size_t len, T& value) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return internal::parseUintT((const char*) s, len, value);
+#else
+  return internal::parseUintT(FlashString(s), len, value);
+#endif
+}
+
+/**
+ * Parse the decimal integer with an optional '+' or '-' sign at the start of
+ * the first `len` characters of `s` into `value`. For an unsigned T, only "-0"
+ * is accepted with a '-' sign.
+ *
+ * @tparam T signed or unsigned integer type, up to 64 bits
+ * @return the number of characters consumed, or 0 if there are no digits or
+ *    if the number does not fit into T, in which case `value` is unchanged
+ */
+template <typename T>
+size_t parseInt(const char* s, size_t len, T& value) {
+  return internal::parseIntT(s, len, value);
+}
+
+/** Same as parseInt(const char*, size_t, T&) for a flash string. */
+template <typename T>
+size_t parseInt(const __FlashStringHelper* s, size_t len, T& value) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return internal::parseIntT((const char*) s, len, value);
+#else
+  return internal::parseIntT(FlashString(s), len, value);
+#endif
+}
+
+/**
+ * Parse the fixed point number with an optional sign (e.g. "-12.345") at the
+ * start of the first `len` characters of `s` into the integer `value`
+ * multiplied by 10^Decimals, the inverse of printFixedPointTo(). For example,
+ * `parseFixedPoint<3>("-12.3", 5, value)` sets `value` to -12300. Fractional
+ * digits beyond `Decimals` are consumed but truncated. The whole part or the
+ * fractional part (but not both) may be empty, as in "12." or ".5".
+ *
+ * @tparam Decimals number of digits after the decimal point, up to 19
+ * @tparam T signed or unsigned integer type, up to 64 bits
+ * @return the number of characters consumed, or 0 if there are no digits or
+ *    if the scaled number does not fit into T, in which case `value` is
+ *    unchanged
+ */
+template <uint8_t Decimals, typename T>
+size_t parseFixedPoint(const char* s, size_t len, T& value) {
+  return internal::parseFixedPointT<Decimals>(s, len, value);
+}
+
+/** Same as parseFixedPoint(const char*, size_t, T&) for a flash string. */
+template <uint8_t Decimals, typename T>
+size_t parseFixedPoint(const __FlashStringHelper* s, size_t len, T& value) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return internal::parseFixedPointT<Decimals>((const char*) s, len, value);
+#else
+  return internal::parseFixedPointT<Decimals>(FlashString(s), len, value);
+#endif
+}
+
+}
+
+#endif
@@ -26,6 +26,7 @@ SOFTWARE.
 #define ACE_COMMON_PRINT_STR_H
 
 #include <stddef.h> // size_t
+#include <string.h> // memcpy()
 #include <Print.h>
 
 namespace ace_common {
@@ -73,17 +74,19 @@ class PrintStrBase: public Print {
       }
     }
 
-    /** Write the `buf` string of `size` into the internal buffer. */
+    /**
+     * Write the `buf` string of `size` into the internal buffer, truncating
+     * the string if the buffer becomes full. The characters are copied as a
+     * single block, instead of calling write(uint8_t) for each character.
+     */
     size_t write(const uint8_t *buf, size_t size) override {
       if (buf == nullptr) return 0;
 
-      size_t n = 0;
-      while (size-- > 0) {
-        size_t ret = write(*buf++);
-        if (ret == 0) break;
-        n++;
-      }
-      return n;
+      size_t available = size_ - 1 - index_;
+      if (size > available) size = available;
+      memcpy(buf_ + index_, buf, size);
+      index_ += size;
+      return size;
     }
 
     /**
@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <string.h> // memcpy()
+#include <Arduino.h> // PROGMEM, memcpy_P()
+#include "../optimize/optimize.h"
+#include "formatUint.h"
+
+// Write 2 digits for each division by 100 using a table of 200 bytes in
+// flash, instead of 1 digit for each division by 10, unless optimizing for
+// size.
+#ifndef ACE_COMMON_FORMAT_DIGIT_PAIRS
+  #if defined(ACE_COMMON_OPTIMIZE_SIZE)
+    #define ACE_COMMON_FORMAT_DIGIT_PAIRS 0
+  #else
+    #define ACE_COMMON_FORMAT_DIGIT_PAIRS 1
+  #endif
+#endif
+
+namespace ace_common {
+
+#if ACE_COMMON_FORMAT_DIGIT_PAIRS
+
+namespace internal {
+
+/**
+ * The decimal digits of 00 to 99, 2 characters for each number. This costs
+ * 200 bytes of flash, but halves the number of divisions.
+ */
+static const char kDigitPairs[200] PROGMEM = {
+  '0','0', '0','1', '0','2', '0','3', '0','4',
+  '0','5', '0','6', '0','7', '0','8', '0','9',
+  '1','0', '1','1', '1','2', '1','3', '1','4',
+  '1','5', '1','6', '1','7', '1','8', '1','9',
+  '2','0', '2','1', '2','2', '2','3', '2','4',
+  '2','5', '2','6', '2','7', '2','8', '2','9',
+  '3','0', '3','1', '3','2', '3','3', '3','4',
+  '3','5', '3','6', '3','7', '3','8', '3','9',
+  '4','0', '4','1', '4','2', '4','3', '4','4',
+  '4','5', '4','6', '4','7', '4','8', '4','9',
+  '5','0', '5','1', '5','2', '5','3', '5','4',
+  '5','5', '5','6', '5','7', '5','8', '5','9',
+  '6','0', '6','1', '6','2', '6','3', '6','4',
+  '6','5', '6','6', '6','7', '6','8', '6','9',
+  '7','0', '7','1', '7','2', '7','3', '7','4',
+  '7','5', '7','6', '7','7', '7','8', '7','9',
+  '8','0', '8','1', '8','2', '8','3', '8','4',
+  '8','5', '8','6', '8','7', '8','8', '8','9',
+  '9','0', '9','1', '9','2', '9','3', '9','4',
+  '9','5', '9','6', '9','7', '9','8', '9','9',
+};
+
+/** Write the 2 digits of `n` (0-99) just before `p`, and return the new p. */
+static char* writeDigitPair(char* p, uint8_t n) {
+  p -= 2;
+  memcpy_P(p, kDigitPairs + 2 * n, 2);
+  return p;
+}
+
+}
+
+char* formatUint(char* end, uint16_t value) {
+  char* p = end;
+  while (value >= 100) {
+    uint16_t q = internal::udiv100(value);
+    p = internal::writeDigitPair(p, value - q * 100);
+    value = q;
+  }
+  if (value >= 10) {
+    p = internal::writeDigitPair(p, value);
+  } else {
+    *--p = '0' + value;
+  }
+  return p;
+}
+
+char* formatUint(char* end, uint32_t value) {
+  char* p = end;
+  while (value > UINT16_MAX) {
+    uint32_t q = value / 100;
+    p = internal::writeDigitPair(p, value - q * 100);
+    value = q;
+  }
+  return formatUint(p, (uint16_t) value);
+}
+
+#else
+
+char* formatUint(char* end, uint16_t value) {
+  char* p = end;
+  while (value >= 10) {
+    uint16_t q = value / 10;
+    *--p = '0' + (value - q * 10);
+    value = q;
+  }
+  *--p = '0' + value;
+  return p;
+}
+
+char* formatUint(char* end, uint32_t value) {
+  char* p = end;
+  while (value > UINT16_MAX) {
+    uint32_t q = value / 10;
+    *--p = '0' + (value - q * 10);
+    value = q;
+  }
+  return formatUint(p, (uint16_t) value);
+}
+
+#endif
+
+char* formatUint(char* end, uint64_t value) {
+  char* p = end;
+  while (value > UINT32_MAX) {
+    uint64_t q = value / 100000000;
+    char* blockEnd = p;
+    p = formatUint(p, (uint32_t) (value - q * 100000000));
+    while (blockEnd - p < 8) *--p = '0';
+    value = q;
+  }
+  return formatUint(p, (uint32_t) value);
+}
+
+}
@@ -0,0 +1,156 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file formatUint.h
+ *
+ * Low-level kernels which convert unsigned integers into decimal digits,
+ * shared by printPadXTo() and printUintXXAsFloat3To(). The digits are written
+ * backwards into a caller-supplied buffer, so that the caller can add padding
+ * and other characters in front, then send the whole field to the `Print`
+ * object using a single `write()`.
+ */
+
+#ifndef ACE_COMMON_FORMAT_UINT_H
+#define ACE_COMMON_FORMAT_UINT_H
+
+#include <stdint.h> // uint16_t, uint32_t, uint64_t
+
+namespace ace_common {
+
+namespace internal {
+
+/**
+ * Exact division of a 16-bit integer by 100, using a multiplication by the
+ * reciprocal instead of a division. Dividing by 4 first allows the product to
+ * fit inside 32 bits. On 8-bit processors, this is several times faster than
+ * the library routine for 16-bit division. (On 32-bit processors, the
+ * compiler already performs this optimization for divisions by a constant.)
+ */
+inline uint16_t udiv100(uint16_t n) {
+  return ((uint32_t) (n >> 2) * 5243) >> 17;
+}
+
+}
+
+/**
+ * Write the decimal digits of `value` into the buffer which ends just before
+ * `end`, going backwards, and return the pointer to the first digit. The
+ * buffer must have room for all the digits, i.e. 5 characters for any 16-bit
+ * value. The digits are NOT NUL terminated.
+ * Two digits are produced per step, using a table of the 100 two-digit pairs.
+ *
+ * @code
+ * char buf[5];
+ * char* end = buf + sizeof(buf);
+ * char* begin = formatUint(end, (uint16_t) 123);
+ * printer.write((const uint8_t*) begin, end - begin); // prints "123"
+ * @endcode
+ */
+char* formatUint(char* end, uint16_t value);
+
+/**
+ * Same as formatUint(char*, uint16_t) for a 32-bit integer, which needs up to
+ * 10 characters. The 32-bit divisions are used only until the remaining value
+ * fits into 16 bits.
+ */
+char* formatUint(char* end, uint32_t value);
+
+/**
+ * Same as formatUint(char*, uint16_t) for a 64-bit integer, which needs up to
+ * 20 characters. The value is split into blocks of 8 digits, so that only 2
+ * (slow) 64-bit divisions are needed in the worst case. The blocks are
+ * formatted using the 32-bit version.
+ */
+char* formatUint(char* end, uint64_t value);
+
+namespace internal {
+
+/**
+ * The unsigned type with the same size as the integer type T, similar to
+ * std::make_unsigned<T>, which is not available on all Arduino platforms.
+ */
+template <typename T> struct UnsignedOf;
+template <> struct UnsignedOf<char> { typedef unsigned char type; };
+template <> struct UnsignedOf<signed char> { typedef unsigned char type; };
+template <> struct UnsignedOf<unsigned char> { typedef unsigned char type; };
+template <> struct UnsignedOf<short> { typedef unsigned short type; };
+template <> struct UnsignedOf<unsigned short> { typedef unsigned short type; };
+template <> struct UnsignedOf<int> { typedef unsigned int type; };
+template <> struct UnsignedOf<unsigned int> { typedef unsigned int type; };
+template <> struct UnsignedOf<long> { typedef unsigned long type; };
+template <> struct UnsignedOf<unsigned long> { typedef unsigned long type; };
+template <> struct UnsignedOf<long long> {
+  typedef unsigned long long type;
+};
+template <> struct UnsignedOf<unsigned long long> {
+  typedef unsigned long long type;
+};
+
+/**
+ * Convert `value` into its unsigned magnitude, and set `negative` if it is
+ * less than 0.
+ */
+template <typename T>
+typename UnsignedOf<T>::type toMagnitude(T value, bool& negative) {
+  typedef typename UnsignedOf<T>::type U;
+  negative = (value < 0);
+  // Negate in the unsigned type, which is correct even for the minimum value.
+  return negative ? (U) (U(0) - (U) value) : (U) value;
+}
+
+/**
+ * Write the digits of the unsigned `value` in the given `Base` backwards
+ * from `end`, and return the pointer to the first digit. Decimal numbers use
+ * the formatUint() kernel of the smallest size which holds the type U. Other
+ * bases extract one digit per step, which the compiler turns into shifts and
+ * masks for powers of 2. Letters are uppercase.
+ */
+template <uint8_t Base, typename U>
+char* formatUintBase(char* end, U value) {
+  if (Base == 10) {
+    if (sizeof(U) <= sizeof(uint16_t)) return formatUint(end, (uint16_t) value);
+    if (sizeof(U) <= sizeof(uint32_t)) return formatUint(end, (uint32_t) value);
+    return formatUint(end, (uint64_t) value);
+  }
+
+  char* p = end;
+  do {
+    uint8_t digit = value % Base;
+    value /= Base;
+    *--p = (digit < 10) ? '0' + digit : 'A' + digit - 10;
+  } while (value != 0);
+  return p;
+}
+
+/** Return 10^n, evaluated at compile time for a constant n. */
+constexpr uint64_t pow10(uint8_t n) {
+  return (n == 0) ? 1 : 10 * pow10(n - 1);
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,215 @@
+#!/usr/bin/python3
+#
+# Generates printFloatToTables.h, the tables of powers of 5 used by the Ryu
+# algorithm in printFloatTo.cpp. The values are computed with exact integer
+# arithmetic, following the Ryu reference implementation
+# (https://github.com/ulfjack/ryu, Copyright 2018 Ulf Adams), used under the
+# Boost Software License 1.0. See the notice emitted into the generated file.
+#
+# Usage: ./generate_float_tables.py > printFloatToTables.h
+
+def pow5bits(e):
+    return ((e * 1217359) >> 19) + 1
+
+FLOAT_POW5_INV_BITCOUNT = 59
+FLOAT_POW5_BITCOUNT = 61
+DOUBLE_POW5_INV_BITCOUNT = 125
+DOUBLE_POW5_BITCOUNT = 125
+
+FLOAT_POW5_INV_SIZE = 31
+FLOAT_POW5_SIZE = 48
+DOUBLE_POW5_INV_SIZE = 292
+DOUBLE_POW5_SIZE = 326
+COMPACT_STEP = 26
+
+M64 = (1 << 64) - 1
+
+
+def inv_split(i, bitcount):
+    return (1 << (pow5bits(i) - 1 + bitcount)) // 5**i + 1
+
+
+def split(i, bitcount):
+    shift = pow5bits(i) - bitcount
+    return 5**i >> shift if shift >= 0 else 5**i << -shift
+
+
+def shift_right_128(lo, hi, dist):
+    return ((hi << (64 - dist)) | (lo >> dist)) & M64
+
+
+def compact_pow5(base_value, m, delta):
+    """Emulate the 64-bit arithmetic of computePow5() in printFloatTo.cpp."""
+    lo, hi = base_value & M64, base_value >> 64
+    b0 = m * lo
+    b2 = m * hi
+    low0, high0 = b0 & M64, b0 >> 64
+    low1, high1 = b2 & M64, b2 >> 64
+    s = (high0 + low1) & M64
+    if s < high0:
+        high1 += 1
+    return shift_right_128(low0, s, delta) | (shift_right_128(s, high1, delta) << 64)
+
+
+def corrections_for(full, compute):
+    result = []
+    for i, value in enumerate(full):
+        c = value - compute(i)
+        assert 0 <= c <= 3, (i, c)
+        result.append(c)
+    return result
+
+
+def pack2(values):
+    words = []
+    for k in range(0, len(values), 16):
+        w = 0
+        for j, v in enumerate(values[k:k + 16]):
+            w |= v << (2 * j)
+        words.append(w)
+    return words
+
+
+float_inv = [inv_split(i, FLOAT_POW5_INV_BITCOUNT)
+             for i in range(FLOAT_POW5_INV_SIZE)]
+float_pow = [split(i, FLOAT_POW5_BITCOUNT) for i in range(FLOAT_POW5_SIZE)]
+double_inv = [inv_split(i, DOUBLE_POW5_INV_BITCOUNT)
+              for i in range(DOUBLE_POW5_INV_SIZE)]
+double_pow = [split(i, DOUBLE_POW5_BITCOUNT) for i in range(DOUBLE_POW5_SIZE)]
+
+# Compact tables: every COMPACT_STEP-th entry, the powers of 5 in between,
+# and 2-bit corrections for the rounding errors of the reconstruction.
+pow5_table = [5**i for i in range(COMPACT_STEP)]
+num_inv_bases = (DOUBLE_POW5_INV_SIZE - 1 + COMPACT_STEP - 1) // COMPACT_STEP + 1
+num_pow_bases = (DOUBLE_POW5_SIZE - 1) // COMPACT_STEP + 1
+inv_bases = [inv_split(b * COMPACT_STEP, DOUBLE_POW5_INV_BITCOUNT)
+             for b in range(num_inv_bases)]
+pow_bases = [split(b * COMPACT_STEP, DOUBLE_POW5_BITCOUNT)
+             for b in range(num_pow_bases)]
+
+
+def compute_pow(i):
+    base = i // COMPACT_STEP
+    base2 = base * COMPACT_STEP
+    offset = i - base2
+    if offset == 0:
+        return pow_bases[base]
+    delta = pow5bits(i) - pow5bits(base2)
+    assert 0 < delta < 64
+    return compact_pow5(pow_bases[base], pow5_table[offset], delta)
+
+
+def compute_inv(i):
+    base = (i + COMPACT_STEP - 1) // COMPACT_STEP
+    base2 = base * COMPACT_STEP
+    offset = base2 - i
+    if offset == 0:
+        return inv_bases[base]
+    delta = pow5bits(base2) - pow5bits(i)
+    assert 0 < delta < 64
+    return compact_pow5(inv_bases[base] - 1, pow5_table[offset], delta) + 1
+
+
+pow_corrections = corrections_for(double_pow, compute_pow)
+inv_corrections = corrections_for(double_inv, compute_inv)
+
+
+def u64(v):
+    return '0x%016XULL' % v
+
+
+def emit_64(name, values, per_line=2):
+    print('static const uint64_t %s[%d] PROGMEM = {' % (name, len(values)))
+    for k in range(0, len(values), per_line):
+        print('  ' + ', '.join(u64(v) for v in values[k:k + per_line]) + ',')
+    print('};')
+    print()
+
+
+def emit_128(name, values):
+    print('static const uint64_t %s[%d][2] PROGMEM = {' % (name, len(values)))
+    for v in values:
+        print('  { %s, %s },' % (u64(v & M64), u64(v >> 64)))
+    print('};')
+    print()
+
+
+def emit_32(name, values, per_line=4):
+    print('static const uint32_t %s[%d] PROGMEM = {' % (name, len(values)))
+    for k in range(0, len(values), per_line):
+        print('  ' + ', '.join('0x%08X' % v for v in values[k:k + per_line])
+              + ',')
+    print('};')
+    print()
+
+
+print('''// DO NOT EDIT: generated by generate_float_tables.py.
+//
+// Tables of powers of 5 for the Ryu algorithm, used only by printFloatTo.cpp.
+// The POW5_INV entries are ceil(2^(pow5bits(i) - 1 + BITCOUNT) / 5^i), and
+// the POW5 entries are 5^i normalized to BITCOUNT bits.
+//
+// The values of these tables are derived from the Ryu reference
+// implementation (https://github.com/ulfjack/ryu), which is:
+//
+// Copyright 2018 Ulf Adams
+//
+// The Ryu sources may be used under the terms of the Apache
+// License, Version 2.0, or alternatively, the Boost Software License,
+// Version 1.0. They are used here under the Boost Software License:
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#ifndef ACE_COMMON_PRINT_FLOAT_TO_TABLES_H
+#define ACE_COMMON_PRINT_FLOAT_TO_TABLES_H
+
+namespace ace_common {
+namespace internal {
+''')
+print('const uint8_t kFloatPow5InvBitCount = %d;' % FLOAT_POW5_INV_BITCOUNT)
+print('const uint8_t kFloatPow5BitCount = %d;' % FLOAT_POW5_BITCOUNT)
+print('const uint8_t kDoublePow5InvBitCount = %d;' % DOUBLE_POW5_INV_BITCOUNT)
+print('const uint8_t kDoublePow5BitCount = %d;' % DOUBLE_POW5_BITCOUNT)
+print('const uint8_t kCompactStep = %d;' % COMPACT_STEP)
+print()
+emit_64('kFloatPow5InvSplit', float_inv)
+emit_64('kFloatPow5Split', float_pow)
+print('#if ACE_COMMON_FLOAT_COMPACT_TABLES')
+print()
+emit_64('kPow5Table', pow5_table)
+emit_128('kDoublePow5InvSplitCompact', inv_bases)
+emit_128('kDoublePow5SplitCompact', pow_bases)
+emit_32('kDoublePow5InvCorrections', pack2(inv_corrections))
+emit_32('kDoublePow5Corrections', pack2(pow_corrections))
+print('#else')
+print()
+emit_128('kDoublePow5InvSplit', double_inv)
+emit_128('kDoublePow5Split', double_pow)
+print('#endif')
+print('''
+} // internal
+} // ace_common
+
+#endif''')
@@ -0,0 +1,786 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Portions of this file are derived from the Ryu reference implementation
+(https://github.com/ulfjack/ryu), which is:
+
+Copyright 2018 Ulf Adams
+
+The Ryu sources may be used under the terms of the Apache
+License, Version 2.0, or alternatively, the Boost Software License,
+Version 1.0. They are used here under the Boost Software License:
+
+Boost Software License - Version 1.0 - August 17th, 2003
+
+Permission is hereby granted, free of charge, to any person or organization
+obtaining a copy of the software and accompanying documentation covered by
+this license (the "Software") to use, reproduce, display, distribute,
+execute, and transmit the Software, and to prepare derivative works of the
+Software, and to permit third-parties to whom the Software is furnished to
+do so, all subject to the following:
+
+The copyright notices in the Software and this entire statement, including
+the above license grant, this restriction and the following disclaimer,
+must be included in all copies of the Software, in whole or in part, and
+all derivative works of the Software, unless such copies or derivative
+works are solely in the form of machine-executable object code generated by
+a source language processor.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * Implementation of printFloatTo() using the Ryu algorithm, adapted from the
+ * reference implementation at https://github.com/ulfjack/ryu (Apache 2.0 or
+ * Boost 1.0 license) by Ulf Adams. The f2d() and d2d() functions calculate the
+ * shortest decimal digits which round-trip, and printDecimalTo() formats
+ * those digits.
+ */
+
+#include <stdint.h>
+#include <string.h> // memcpy(), memset()
+#include <Arduino.h> // PROGMEM, memcpy_P()
+#include "../optimize/optimize.h"
+#include "formatUint.h"
+#include "printFloatTo.h"
+
+// Select the compact tables of powers of 5 for the double version on
+// microcontrollers, which saves about 9 kB of flash. The size or speed policy
+// of optimize.h overrides the platform default.
+#ifndef ACE_COMMON_FLOAT_COMPACT_TABLES
+  #if defined(ACE_COMMON_OPTIMIZE_SIZE)
+    #define ACE_COMMON_FLOAT_COMPACT_TABLES 1
+  #elif defined(ACE_COMMON_OPTIMIZE_SPEED)
+    #define ACE_COMMON_FLOAT_COMPACT_TABLES 0
+  #elif defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+    #define ACE_COMMON_FLOAT_COMPACT_TABLES 0
+  #else
+    #define ACE_COMMON_FLOAT_COMPACT_TABLES 1
+  #endif
+#endif
+
+#include "printFloatToTables.h"
+
+namespace ace_common {
+
+namespace internal {
+
+/** Decimal number equal to `digits * 10^exponent`. */
+struct FloatDecimal {
+  uint64_t digits;
+  int16_t exponent;
+};
+
+/** Returns ceil(log2(5^e)) for 0 <= e <= 3528, or 1 if e == 0. */
+static inline int16_t pow5bits(int16_t e) {
+  return (int16_t) ((((uint32_t) e * 1217359) >> 19) + 1);
+}
+
+/** Returns floor(log10(2^e)) for 0 <= e <= 1650. */
+static inline uint16_t log10Pow2(int16_t e) {
+  return (uint16_t) (((uint32_t) e * 78913) >> 18);
+}
+
+/** Returns floor(log10(5^e)) for 0 <= e <= 2620. */
+static inline uint16_t log10Pow5(int16_t e) {
+  return (uint16_t) (((uint32_t) e * 732923) >> 20);
+}
+
+/** Returns true if `value` is divisible by 5^p. */
+template <typename T>
+static bool multipleOfPowerOf5(T value, uint16_t p) {
+  uint16_t count = 0;
+  while (value % 5 == 0) {
+    value /= 5;
+    count++;
+  }
+  return count >= p;
+}
+
+/** Returns true if `value` is divisible by 2^p. */
+template <typename T>
+static inline bool multipleOfPowerOf2(T value, uint16_t p) {
+  return (value & (((T) 1 << p) - 1)) == 0;
+}
+
+/** Read a uint64_t from flash memory. */
+static inline uint64_t readU64(const uint64_t* p) {
+  uint64_t value;
+  memcpy_P(&value, p, sizeof(value));
+  return value;
+}
+
+/** Returns `(m * factor) >> shift` for 32 < shift, truncated to 32 bits. */
+static inline uint32_t mulShift32(uint32_t m, uint64_t factor, int16_t shift) {
+  uint64_t b0 = (uint64_t) m * (uint32_t) factor;
+  uint64_t b1 = (uint64_t) m * (uint32_t) (factor >> 32);
+  uint64_t sum = (b0 >> 32) + b1;
+  return (uint32_t) (sum >> (shift - 32));
+}
+
+/** Calculate the shortest decimal digits of the float `mantissa * 2^exponent`. */
+static FloatDecimal f2d(uint32_t ieeeMantissa, uint16_t ieeeExponent) {
+  int16_t e2;
+  uint32_t m2;
+  if (ieeeExponent == 0) {
+    e2 = 1 - 127 - 23 - 2;
+    m2 = ieeeMantissa;
+  } else {
+    e2 = (int16_t) ieeeExponent - 127 - 23 - 2;
+    m2 = ((uint32_t) 1 << 23) | ieeeMantissa;
+  }
+  const bool acceptBounds = (m2 & 1) == 0;
+
+  // Step 2: Determine the interval of valid decimal representations.
+  const uint32_t mv = 4 * m2;
+  const uint32_t mp = 4 * m2 + 2;
+  const uint32_t mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1);
+  const uint32_t mm = 4 * m2 - 1 - mmShift;
+
+  // Step 3: Convert to a decimal power base using 64-bit arithmetic.
+  uint32_t vr, vp, vm;
+  int16_t e10;
+  bool vmIsTrailingZeros = false;
+  bool vrIsTrailingZeros = false;
+  uint8_t lastRemovedDigit = 0;
+  if (e2 >= 0) {
+    const uint16_t q = log10Pow2(e2);
+    e10 = q;
+    const int16_t k = kFloatPow5InvBitCount + pow5bits(q) - 1;
+    const int16_t i = -e2 + q + k;
+    const uint64_t factor = readU64(&kFloatPow5InvSplit[q]);
+    vr = mulShift32(mv, factor, i);
+    vp = mulShift32(mp, factor, i);
+    vm = mulShift32(mm, factor, i);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      // The last removed digit is needed for rounding, because the loop below
+      // may not remove any digits.
+      const int16_t l = kFloatPow5InvBitCount + pow5bits(q - 1) - 1;
+      lastRemovedDigit = (uint8_t) (mulShift32(mv,
+          readU64(&kFloatPow5InvSplit[q - 1]), -e2 + q - 1 + l) % 10);
+    }
+    if (q <= 9) {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (mv % 5 == 0) {
+        vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+      } else if (acceptBounds) {
+        vmIsTrailingZeros = multipleOfPowerOf5(mm, q);
+      } else {
+        vp -= multipleOfPowerOf5(mp, q);
+      }
+    }
+  } else {
+    const uint16_t q = log10Pow5(-e2);
+    e10 = q + e2;
+    const int16_t i = -e2 - q;
+    const int16_t k = pow5bits(i) - kFloatPow5BitCount;
+    int16_t j = q - k;
+    const uint64_t factor = readU64(&kFloatPow5Split[i]);
+    vr = mulShift32(mv, factor, j);
+    vp = mulShift32(mp, factor, j);
+    vm = mulShift32(mm, factor, j);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      j = q - 1 - (pow5bits(i + 1) - kFloatPow5BitCount);
+      lastRemovedDigit = (uint8_t) (mulShift32(mv,
+          readU64(&kFloatPow5Split[i + 1]), j) % 10);
+    }
+    if (q <= 1) {
+      // mv = 4 * m2 always has at least 2 trailing 0 bits.
+      vrIsTrailingZeros = true;
+      if (acceptBounds) {
+        vmIsTrailingZeros = mmShift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 31) {
+      vrIsTrailingZeros = multipleOfPowerOf2(mv, q - 1);
+    }
+  }
+
+  // Step 4: Find the shortest decimal representation in the interval.
+  int16_t removed = 0;
+  uint32_t output;
+  if (vmIsTrailingZeros || vrIsTrailingZeros) {
+    // General case, which happens rarely (~4.0%).
+    while (vp / 10 > vm / 10) {
+      vmIsTrailingZeros &= vm % 10 == 0;
+      vrIsTrailingZeros &= lastRemovedDigit == 0;
+      lastRemovedDigit = (uint8_t) (vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vmIsTrailingZeros) {
+      while (vm % 10 == 0) {
+        vrIsTrailingZeros &= lastRemovedDigit == 0;
+        lastRemovedDigit = (uint8_t) (vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+      // Round even if the exact number is .....50..0.
+      lastRemovedDigit = 4;
+    }
+    output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros))
+        || lastRemovedDigit >= 5);
+  } else {
+    // Common case.
+    while (vp / 10 > vm / 10) {
+      lastRemovedDigit = (uint8_t) (vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || lastRemovedDigit >= 5);
+  }
+
+  FloatDecimal fd;
+  fd.digits = output;
+  fd.exponent = e10 + removed;
+  return fd;
+}
+
+#if ! (defined(__SIZEOF_DOUBLE__) && __SIZEOF_DOUBLE__ == 4)
+
+/** Returns the 128-bit product of `a * b` as `*high:low`. */
+static inline uint64_t umul128(uint64_t a, uint64_t b, uint64_t* high) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product = (unsigned __int128) a * b;
+  *high = (uint64_t) (product >> 64);
+  return (uint64_t) product;
+#else
+  const uint32_t aLo = (uint32_t) a;
+  const uint32_t aHi = (uint32_t) (a >> 32);
+  const uint32_t bLo = (uint32_t) b;
+  const uint32_t bHi = (uint32_t) (b >> 32);
+
+  const uint64_t b00 = (uint64_t) aLo * bLo;
+  const uint64_t b01 = (uint64_t) aLo * bHi;
+  const uint64_t b10 = (uint64_t) aHi * bLo;
+  const uint64_t b11 = (uint64_t) aHi * bHi;
+
+  const uint64_t mid1 = b10 + (b00 >> 32);
+  const uint64_t mid2 = b01 + (uint32_t) mid1;
+  *high = b11 + (mid1 >> 32) + (mid2 >> 32);
+  return (mid2 << 32) | (uint32_t) b00;
+#endif
+}
+
+/** Returns `(high:low) >> dist` for 0 < dist < 64, truncated to 64 bits. */
+static inline uint64_t shiftRight128(uint64_t low, uint64_t high, uint8_t dist) {
+  return (high << (64 - dist)) | (low >> dist);
+}
+
+/** Returns `(m * mul) >> j` for 64 < j < 128, truncated to 64 bits. */
+static inline uint64_t mulShift64(uint64_t m, const uint64_t mul[2],
+    int16_t j) {
+  uint64_t high0;
+  umul128(m, mul[0], &high0);
+  uint64_t high1;
+  const uint64_t low1 = umul128(m, mul[1], &high1);
+  const uint64_t sum = high0 + low1;
+  if (sum < high0) ++high1;
+  return shiftRight128(sum, high1, (uint8_t) (j - 64));
+}
+
+#if ACE_COMMON_FLOAT_COMPACT_TABLES
+
+/** Read the 2-bit correction at index `i` from the packed `table`. */
+static inline uint8_t readCorrection(const uint32_t* table, int16_t i) {
+  uint32_t word;
+  memcpy_P(&word, &table[i / 16], sizeof(word));
+  return (word >> ((i % 16) * 2)) & 3;
+}
+
+/**
+ * Compute the entry `i` of the full kDoublePow5Split table from the nearest
+ * smaller compact entry multiplied by a small power of 5.
+ */
+static void getDoublePow5(int16_t i, uint64_t result[2]) {
+  const int16_t base = i / kCompactStep;
+  const int16_t base2 = base * kCompactStep;
+  const int16_t offset = i - base2;
+  uint64_t mul[2];
+  memcpy_P(mul, kDoublePow5SplitCompact[base], sizeof(mul));
+  if (offset == 0) {
+    result[0] = mul[0];
+    result[1] = mul[1];
+    return;
+  }
+  const uint64_t m = readU64(&kPow5Table[offset]);
+  uint64_t high1;
+  const uint64_t low1 = umul128(m, mul[1], &high1);
+  uint64_t high0;
+  const uint64_t low0 = umul128(m, mul[0], &high0);
+  const uint64_t sum = high0 + low1;
+  if (sum < high0) ++high1;
+  const uint8_t delta = pow5bits(i) - pow5bits(base2);
+  result[0] = shiftRight128(low0, sum, delta)
+      + readCorrection(kDoublePow5Corrections, i);
+  result[1] = shiftRight128(sum, high1, delta);
+}
+
+/**
+ * Compute the entry `i` of the full kDoublePow5InvSplit table from the nearest
+ * larger compact entry multiplied by a small power of 5.
+ */
+static void getDoublePow5Inv(int16_t i, uint64_t result[2]) {
+  const int16_t base = (i + kCompactStep - 1) / kCompactStep;
+  const int16_t base2 = base * kCompactStep;
+  const int16_t offset = base2 - i;
+  uint64_t mul[2];
+  memcpy_P(mul, kDoublePow5InvSplitCompact[base], sizeof(mul));
+  if (offset == 0) {
+    result[0] = mul[0];
+    result[1] = mul[1];
+    return;
+  }
+  const uint64_t m = readU64(&kPow5Table[offset]);
+  uint64_t high1;
+  const uint64_t low1 = umul128(m, mul[1], &high1);
+  uint64_t high0;
+  const uint64_t low0 = umul128(m, mul[0] - 1, &high0);
+  const uint64_t sum = high0 + low1;
+  if (sum < high0) ++high1;
+  const uint8_t delta = pow5bits(base2) - pow5bits(i);
+  result[0] = shiftRight128(low0, sum, delta) + 1
+      + readCorrection(kDoublePow5InvCorrections, i);
+  result[1] = shiftRight128(sum, high1, delta);
+}
+
+#else
+
+static inline void getDoublePow5(int16_t i, uint64_t result[2]) {
+  memcpy_P(result, kDoublePow5Split[i], 2 * sizeof(uint64_t));
+}
+
+static inline void getDoublePow5Inv(int16_t i, uint64_t result[2]) {
+  memcpy_P(result, kDoublePow5InvSplit[i], 2 * sizeof(uint64_t));
+}
+
+#endif
+
+/** Calculate the shortest decimal digits of the double `mantissa * 2^exponent`. */
+static FloatDecimal d2d(uint64_t ieeeMantissa, uint16_t ieeeExponent) {
+  int16_t e2;
+  uint64_t m2;
+  if (ieeeExponent == 0) {
+    e2 = 1 - 1023 - 52 - 2;
+    m2 = ieeeMantissa;
+  } else {
+    e2 = (int16_t) ieeeExponent - 1023 - 52 - 2;
+    m2 = ((uint64_t) 1 << 52) | ieeeMantissa;
+  }
+  const bool acceptBounds = (m2 & 1) == 0;
+
+  // Step 2: Determine the interval of valid decimal representations.
+  const uint64_t mv = 4 * m2;
+  const uint32_t mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1);
+
+  // Step 3: Convert to a decimal power base using 128-bit arithmetic.
+  uint64_t vr, vp, vm;
+  int16_t e10;
+  bool vmIsTrailingZeros = false;
+  bool vrIsTrailingZeros = false;
+  uint64_t mul[2];
+  if (e2 >= 0) {
+    const uint16_t q = log10Pow2(e2) - (e2 > 3);
+    e10 = q;
+    const int16_t k = kDoublePow5InvBitCount + pow5bits(q) - 1;
+    const int16_t i = -e2 + q + k;
+    getDoublePow5Inv(q, mul);
+    vr = mulShift64(4 * m2, mul, i);
+    vp = mulShift64(4 * m2 + 2, mul, i);
+    vm = mulShift64(4 * m2 - 1 - mmShift, mul, i);
+    if (q <= 21) {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (mv % 5 == 0) {
+        vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+      } else if (acceptBounds) {
+        vmIsTrailingZeros = multipleOfPowerOf5(mv - 1 - mmShift, q);
+      } else {
+        vp -= multipleOfPowerOf5(mv + 2, q);
+      }
+    }
+  } else {
+    const uint16_t q = log10Pow5(-e2) - (-e2 > 1);
+    e10 = q + e2;
+    const int16_t i = -e2 - q;
+    const int16_t k = pow5bits(i) - kDoublePow5BitCount;
+    const int16_t j = q - k;
+    getDoublePow5(i, mul);
+    vr = mulShift64(4 * m2, mul, j);
+    vp = mulShift64(4 * m2 + 2, mul, j);
+    vm = mulShift64(4 * m2 - 1 - mmShift, mul, j);
+    if (q <= 1) {
+      // mv = 4 * m2 always has at least 2 trailing 0 bits.
+      vrIsTrailingZeros = true;
+      if (acceptBounds) {
+        vmIsTrailingZeros = mmShift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vrIsTrailingZeros = multipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // Step 4: Find the shortest decimal representation in the interval.
+  int16_t removed = 0;
+  uint8_t lastRemovedDigit = 0;
+  uint64_t output;
+  if (vmIsTrailingZeros || vrIsTrailingZeros) {
+    // General case, which happens rarely (~0.7%).
+    while (vp / 10 > vm / 10) {
+      vmIsTrailingZeros &= vm % 10 == 0;
+      vrIsTrailingZeros &= lastRemovedDigit == 0;
+      lastRemovedDigit = (uint8_t) (vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vmIsTrailingZeros) {
+      while (vm % 10 == 0) {
+        vrIsTrailingZeros &= lastRemovedDigit == 0;
+        lastRemovedDigit = (uint8_t) (vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+      // Round even if the exact number is .....50..0.
+      lastRemovedDigit = 4;
+    }
+    output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros))
+        || lastRemovedDigit >= 5);
+  } else {
+    // Specialized for the common case (~99.3%).
+    bool roundUp = false;
+    while (vp / 10 > vm / 10) {
+      roundUp = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || roundUp);
+  }
+
+  FloatDecimal fd;
+  fd.digits = output;
+  fd.exponent = e10 + removed;
+  return fd;
+}
+
+#endif
+
+/** Print `count` '0' characters. */
+static size_t printZerosTo(Print& printer, int16_t count) {
+  static const char kZeros[] = "0000000000000000";
+  size_t n = 0;
+  while (count > 0) {
+    uint8_t chunk = (count < 16) ? count : 16;
+    n += printer.write((const uint8_t*) kZeros, chunk);
+    count -= chunk;
+  }
+  return n;
+}
+
+/**
+ * Print the `numDigits` digits in `s` in fixed notation, with the decimal
+ * point at `point` digits from the start of `s`, followed by exactly
+ * `numFrac` fractional digits.
+ */
+static size_t printFixedTo(Print& printer, const char* s, int16_t numDigits,
+    int16_t point, int16_t numFrac) {
+  size_t n = 0;
+
+  // Integer part.
+  if (point <= 0) {
+    n += printer.write('0');
+  } else if (point <= numDigits) {
+    n += printer.write((const uint8_t*) s, point);
+  } else {
+    n += printer.write((const uint8_t*) s, numDigits);
+    n += printZerosTo(printer, point - numDigits);
+  }
+  if (numFrac <= 0) return n;
+
+  // Fractional part.
+  n += printer.write('.');
+  int16_t remaining = numFrac;
+  if (point < 0) {
+    int16_t zeros = (-point < remaining) ? -point : remaining;
+    n += printZerosTo(printer, zeros);
+    remaining -= zeros;
+    point = 0;
+  }
+  if (point < numDigits && remaining > 0) {
+    int16_t count = numDigits - point;
+    if (count > remaining) count = remaining;
+    n += printer.write((const uint8_t*) s + point, count);
+    remaining -= count;
+  }
+  n += printZerosTo(printer, remaining);
+  return n;
+}
+
+/**
+ * Number of 32-bit words of the fraction in printExactFixedTo(). A value
+ * below 2^-459 (when the fraction would need more words) is printed as zero,
+ * which is correct for any precision up to 127.
+ */
+static const uint8_t kFracWords = 16;
+
+/** Print the `integer`, followed by a '.' if `precision` is positive. */
+static size_t printIntegerPartTo(Print& printer, uint64_t integer,
+    int8_t precision) {
+  char buf[20];
+  char* const end = buf + sizeof(buf);
+  char* s = formatUint(end, integer);
+  size_t n = printer.write((const uint8_t*) s, end - s);
+  if (precision > 0) n += printer.write('.');
+  return n;
+}
+
+/** Print `count` copies of the character `c`. */
+static size_t printRepeatTo(Print& printer, char c, uint8_t count) {
+  size_t n = 0;
+  for (; count > 0; count--) n += printer.write(c);
+  return n;
+}
+
+/**
+ * Print the binary number `mantissa * 2^exponent2` in fixed notation with
+ * exactly `precision` digits after the decimal point. The digits are
+ * calculated from the exact binary value, and the last one is rounded half to
+ * even, like printf("%.*f"). The integer part must fit in a uint64_t, which
+ * is always the case when `exponent2` is negative, because the mantissa has
+ * at most 53 bits.
+ *
+ * The fraction is multiplied by 10 to get each digit. A digit followed by a
+ * run of 9s is held back until the end of the run, because the rounding may
+ * carry into it, so that no buffer is needed for the digits.
+ */
+static size_t printExactFixedTo(Print& printer, uint64_t mantissa,
+    int16_t exponent2, int8_t precision) {
+  // Fixed point fraction, with the binary point above frac[numWords - 1].
+  uint32_t frac[kFracWords];
+  uint8_t numWords = 0;
+  uint64_t integer;
+  if (exponent2 >= 0) {
+    integer = mantissa << exponent2;
+  } else {
+    uint16_t q = -exponent2;
+    integer = (q < 64) ? mantissa >> q : 0;
+    uint64_t f = (q < 64) ? mantissa & (((uint64_t) 1 << q) - 1) : mantissa;
+    if (q <= kFracWords * 32 && f != 0) {
+      numWords = (q + 31) / 32;
+      uint8_t shift = numWords * 32 - q;
+      memset(frac, 0, sizeof(frac));
+      uint64_t low = f << shift;
+      frac[0] = (uint32_t) low;
+      if (numWords > 1) frac[1] = (uint32_t) (low >> 32);
+      if (numWords > 2 && shift > 0) frac[2] = (uint32_t) (f >> (64 - shift));
+    }
+  }
+
+  size_t n = 0;
+  bool integerPending = true;
+  uint8_t pending = 0;
+  uint8_t nines = 0;
+  for (int8_t i = 0; i < precision; i++) {
+    uint32_t carry = 0;
+    for (uint8_t w = 0; w < numWords; w++) {
+      uint64_t x = (uint64_t) frac[w] * 10 + carry;
+      frac[w] = (uint32_t) x;
+      carry = x >> 32;
+    }
+    if (carry == 9) {
+      nines++;
+      continue;
+    }
+    if (integerPending) {
+      n += printIntegerPartTo(printer, integer, precision);
+      integerPending = false;
+    } else {
+      n += printer.write('0' + pending);
+    }
+    n += printRepeatTo(printer, '9', nines);
+    pending = carry;
+    nines = 0;
+  }
+
+  // Round half to even, using the remaining fraction.
+  bool roundUp = false;
+  if (numWords > 0) {
+    uint32_t top = frac[numWords - 1];
+    if (top != 0x80000000) {
+      roundUp = top > 0x80000000;
+    } else {
+      for (uint8_t w = 0; w + 1 < numWords; w++) {
+        if (frac[w] != 0) roundUp = true;
+      }
+      if (! roundUp) {
+        uint8_t last = (nines > 0) ? 9
+            : integerPending ? (uint8_t) (integer % 10) : pending;
+        roundUp = (last & 1) != 0;
+      }
+    }
+  }
+
+  if (integerPending) {
+    n += printIntegerPartTo(printer, integer + roundUp, precision);
+  } else {
+    n += printer.write('0' + pending + roundUp);
+  }
+  n += printRepeatTo(printer, roundUp ? '0' : '9', nines);
+  return n;
+}
+
+/**
+ * Print the decimal number `fd`, which is the shortest representation of the
+ * binary number `mantissa * 2^exponent2`, using the format selected by
+ * `precision`. See printFloatTo().
+ */
+static size_t printDecimalTo(Print& printer, bool negative,
+    const FloatDecimal& fd, uint64_t mantissa, int16_t exponent2,
+    int8_t precision) {
+  char buf[20];
+  char* const end = buf + sizeof(buf);
+  char* s = formatUint(end, fd.digits);
+  int16_t numDigits = end - s;
+  int16_t exponent = fd.exponent;
+  while (numDigits > 1 && s[numDigits - 1] == '0') {
+    numDigits--;
+    exponent++;
+  }
+  // The value is 0.[s] * 10^point.
+  int16_t point = numDigits + exponent;
+
+  size_t n = 0;
+  if (negative) n += printer.write('-');
+
+  if (precision < 0) {
+    if (point > -6 && point <= 21) {
+      int16_t numFrac = numDigits - point;
+      return n + printFixedTo(printer, s, numDigits, point, numFrac);
+    }
+    n += printer.write(s[0]);
+    if (numDigits > 1) {
+      n += printer.write('.');
+      n += printer.write((const uint8_t*) s + 1, numDigits - 1);
+    }
+    int16_t e = point - 1;
+    n += printer.write('e');
+    n += printer.write((e < 0) ? '-' : '+');
+    char ebuf[5];
+    char* ebegin = formatUint(ebuf + sizeof(ebuf),
+        (uint16_t) ((e < 0) ? -e : e));
+    n += printer.write((const uint8_t*) ebegin, ebuf + sizeof(ebuf) - ebegin);
+    return n;
+  }
+
+  // A value with a fraction, or an integer which fits in 64 bits, is printed
+  // from its exact binary value. A larger integer is printed using its
+  // shortest digits followed by zeros.
+  if (exponent2 <= 0
+      || (exponent2 < 64 && (mantissa >> (64 - exponent2)) == 0)) {
+    return n + printExactFixedTo(printer, mantissa, exponent2, precision);
+  }
+  return n + printFixedTo(printer, s, numDigits, point, precision);
+}
+
+} // internal
+
+size_t printFloatTo(Print& printer, float value, int8_t precision) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const bool negative = (bits >> 31) != 0;
+  const uint32_t ieeeMantissa = bits & (((uint32_t) 1 << 23) - 1);
+  const uint16_t ieeeExponent = (bits >> 23) & 0xFF;
+
+  if (ieeeExponent == 0xFF) {
+    if (ieeeMantissa != 0) return printer.print(F("nan"));
+    return printer.print(negative ? F("-inf") : F("inf"));
+  }
+
+  if (ieeeExponent == 0 && ieeeMantissa == 0) {
+    // Print -0.0 as "0", like Print::print(double).
+    const internal::FloatDecimal zero = {0, 0};
+    return internal::printDecimalTo(printer, false, zero, 0, 0, precision);
+  }
+  const internal::FloatDecimal fd = internal::f2d(ieeeMantissa, ieeeExponent);
+  const uint32_t mantissa = (ieeeExponent == 0)
+      ? ieeeMantissa : ieeeMantissa | ((uint32_t) 1 << 23);
+  const int16_t exponent2 = ((ieeeExponent == 0) ? 1 : ieeeExponent) - 150;
+  return internal::printDecimalTo(
+      printer, negative, fd, mantissa, exponent2, precision);
+}
+
+#if ! (defined(__SIZEOF_DOUBLE__) && __SIZEOF_DOUBLE__ == 4)
+
+size_t printFloatTo(Print& printer, double value, int8_t precision) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const bool negative = (bits >> 63) != 0;
+  const uint64_t ieeeMantissa = bits & (((uint64_t) 1 << 52) - 1);
+  const uint16_t ieeeExponent = (bits >> 52) & 0x7FF;
+
+  if (ieeeExponent == 0x7FF) {
+    if (ieeeMantissa != 0) return printer.print(F("nan"));
+    return printer.print(negative ? F("-inf") : F("inf"));
+  }
+
+  if (ieeeExponent == 0 && ieeeMantissa == 0) {
+    // Print -0.0 as "0", like Print::print(double).
+    const internal::FloatDecimal zero = {0, 0};
+    return internal::printDecimalTo(printer, false, zero, 0, 0, precision);
+  }
+  const internal::FloatDecimal fd = internal::d2d(ieeeMantissa, ieeeExponent);
+  const uint64_t mantissa = (ieeeExponent == 0)
+      ? ieeeMantissa : ieeeMantissa | ((uint64_t) 1 << 52);
+  const int16_t exponent2 = ((ieeeExponent == 0) ? 1 : ieeeExponent) - 1075;
+  return internal::printDecimalTo(
+      printer, negative, fd, mantissa, exponent2, precision);
+}
+
+#endif
+
+}
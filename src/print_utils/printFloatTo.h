@@ -0,0 +1,102 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file printFloatTo.h
+ *
+ * Print floating point numbers using the shortest representation which
+ * converts back to exactly the same number (i.e. "round-trips"), using the
+ * Ryu algorithm by Ulf Adams (https://github.com/ulfjack/ryu). Unlike
+ * `Print::print(double, digits)`, the digits are calculated using only integer
+ * arithmetic, so they are always accurate, and large or small numbers are
+ * printed correctly instead of as "ovf" or "0.00".
+ *
+ * The `double` version needs tables of powers of 5. By default, the full
+ * tables (about 10 kB of flash) are used on Linux, MacOS and Windows, and
+ * compact tables (about 0.8 kB) which are expanded on demand with a few extra
+ * multiplications are used on microcontrollers. The selection can be
+ * overridden by defining `ACE_COMMON_FLOAT_COMPACT_TABLES` to 0 or 1 when
+ * compiling the library. On platforms where `double` is the same size as
+ * `float` (e.g. AVR), only the small `float` tables are used.
+ */
+
+#ifndef ACE_COMMON_PRINT_FLOAT_TO_H
+#define ACE_COMMON_PRINT_FLOAT_TO_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // int8_t
+#include <Print.h>
+
+namespace ace_common {
+
+/**
+ * Print the float `value` to the `printer`.
+ *
+ * If `precision` is negative (the default), the shortest sequence of digits
+ * which round-trips is printed. Numbers whose decimal exponent is between -7
+ * and 20 are printed in fixed notation (e.g. "0.1", "123.25", "100"), other
+ * numbers are printed in scientific notation (e.g. "1e+21", "1.5e-7"), the
+ * same rules used by JavaScript.
+ *
+ * If `precision` is 0 or greater, the number is printed in fixed notation
+ * with exactly `precision` digits after the decimal point, like
+ * `Print::print(double, digits)`. The rounding is determined by the exact
+ * binary value, with ties rounded half to even, like `printf("%.*f")` (e.g.
+ * 9.995 is printed as "9.99" with a precision of 2, because the double
+ * closest to 9.995 is slightly smaller). Integers of 2^64 and above, which
+ * have no fractional part, are printed using their shortest digits followed by
+ * zeros (e.g. "1e+23" with a precision of 1 is printed as
+ * "100000000000000000000000.0").
+ *
+ * Negative zero is printed as "0". NaN and infinity are printed as "nan",
+ * "inf" and "-inf".
+ *
+ * @return number of characters printed
+ */
+size_t printFloatTo(Print& printer, float value, int8_t precision = -1);
+
+#if defined(__SIZEOF_DOUBLE__) && __SIZEOF_DOUBLE__ == 4
+
+/**
+ * Version of printFloatTo() for a double, on platforms where a double is the
+ * same as a float.
+ */
+inline size_t printFloatTo(Print& printer, double value, int8_t precision = -1) {
+  return printFloatTo(printer, (float) value, precision);
+}
+
+#else
+
+/**
+ * Version of printFloatTo() for a double, which prints the shortest
+ * representation of the double, for example "0.1" instead of
+ * "0.10000000149011612" for 0.1f promoted to a double.
+ */
+size_t printFloatTo(Print& printer, double value, int8_t precision = -1);
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,449 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file printFormatTo.h
+ *
+ * A type-safe alternative to printfTo() implemented using variadic templates.
+ * Each argument is converted into an internal::FormatArg which records its
+ * type, so the length modifiers of printf() (e.g. "%ld") are not needed and
+ * mismatches between the format string and the arguments cannot read garbage
+ * from the stack. The output is sent directly to the `Print` object, so there
+ * is no intermediate buffer and no limit on the length of the output.
+ *
+ * Like printfTo(), everything is defined in this header file, so that nothing
+ * is pulled into the binary unless it is actually used.
+ */
+
+#ifndef ACE_COMMON_PRINT_FORMAT_TO_H
+#define ACE_COMMON_PRINT_FORMAT_TO_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+#include <string.h> // strlen()
+#include <Arduino.h> // strlen_P()
+#include <Print.h>
+#include "../fstrings/FlashString.h"
+#include "printReplaceTo.h" // internal::printRunTo(), internal::findRunLength()
+
+namespace ace_common {
+
+namespace internal {
+
+/**
+ * A single argument of printFormatTo(), with its type erased into a tagged
+ * union. The implicit constructors define the set of supported types.
+ * Integers are limited to `long` and `unsigned long`, to avoid pulling in the
+ * 64-bit division routines on 8-bit and 32-bit processors.
+ */
+struct FormatArg {
+  static const uint8_t kTypeNone = 0;
+  static const uint8_t kTypeInt = 1;
+  static const uint8_t kTypeUint = 2;
+  static const uint8_t kTypeChar = 3;
+  static const uint8_t kTypeDouble = 4;
+  static const uint8_t kTypeCstring = 5;
+  static const uint8_t kTypeFstring = 6;
+
+  FormatArg() : type(kTypeNone), size(0) {}
+
+  FormatArg(bool v) : type(kTypeUint), size(sizeof(v)) { value.u = v; }
+  FormatArg(char v) : type(kTypeChar), size(sizeof(v)) { value.i = v; }
+
+  FormatArg(signed char v) : type(kTypeInt), size(sizeof(v)) { value.i = v; }
+  FormatArg(short v) : type(kTypeInt), size(sizeof(v)) { value.i = v; }
+  FormatArg(int v) : type(kTypeInt), size(sizeof(v)) { value.i = v; }
+  FormatArg(long v) : type(kTypeInt), size(sizeof(v)) { value.i = v; }
+
+  FormatArg(unsigned char v) : type(kTypeUint), size(sizeof(v)) {
+    value.u = v;
+  }
+  FormatArg(unsigned short v) : type(kTypeUint), size(sizeof(v)) {
+    value.u = v;
+  }
+  FormatArg(unsigned int v) : type(kTypeUint), size(sizeof(v)) {
+    value.u = v;
+  }
+  FormatArg(unsigned long v) : type(kTypeUint), size(sizeof(v)) {
+    value.u = v;
+  }
+
+  FormatArg(float v) : type(kTypeDouble), size(sizeof(v)) { value.d = v; }
+  FormatArg(double v) : type(kTypeDouble), size(sizeof(v)) { value.d = v; }
+
+  FormatArg(const char* v) : type(kTypeCstring), size(sizeof(v)) {
+    value.s = v;
+  }
+  FormatArg(const __FlashStringHelper* v) :
+      type(kTypeFstring), size(sizeof(v)) {
+    value.s = (const char*) v;
+  }
+
+  /** Type of the argument, one of the kTypeXxx constants. */
+  uint8_t type;
+
+  /** sizeof() the original argument, to print negative numbers in hex. */
+  uint8_t size;
+
+  union {
+    long i;
+    unsigned long u;
+    double d;
+    const char* s;
+  } value;
+};
+
+/** The conversion specification "%[flags][width][.precision]conversion". */
+struct FormatSpec {
+  static const uint8_t kFlagLeft = 0x01;
+  static const uint8_t kFlagZero = 0x02;
+  static const uint8_t kFlagPlus = 0x04;
+  static const uint8_t kFlagSpace = 0x08;
+
+  /** Largest width or precision, larger values are clamped to it. */
+  static const int16_t kMaxWidth = 0x7FFF;
+
+  uint8_t flags;
+  uint16_t width;
+  int16_t precision; // -1 if not given
+  char conversion;
+};
+
+/** Clamp a width or precision to FormatSpec::kMaxWidth. */
+inline int16_t clampWidth(long value) {
+  return (value > FormatSpec::kMaxWidth)
+      ? FormatSpec::kMaxWidth
+      : (int16_t) value;
+}
+
+/** A Print which discards everything, used to measure a field. */
+class CountingPrint: public Print {
+  public:
+    size_t write(uint8_t /*c*/) override { return 1; }
+    size_t write(const uint8_t* /*buf*/, size_t size) override { return size; }
+};
+
+/** Print `c` repeated `n` times. */
+inline void printRepeatTo(Print& printer, char c, size_t n) {
+  while (n-- > 0) printer.write(c);
+}
+
+/**
+ * Print a field consisting of the `sign` (if not '\0'), then `numZeros` zeros,
+ * then the body of `bodyLength` characters produced by `printBody`, padded to
+ * `spec.width`.
+ *
+ * @return number of characters printed
+ */
+template <typename F>
+size_t printFieldTo(Print& printer, const FormatSpec& spec, char sign,
+    size_t numZeros, size_t bodyLength, F printBody) {
+  size_t length = (sign ? 1 : 0) + numZeros + bodyLength;
+  size_t pad = (spec.width > length) ? spec.width - length : 0;
+
+  bool left = spec.flags & FormatSpec::kFlagLeft;
+  bool zero = (spec.flags & FormatSpec::kFlagZero) && ! left;
+  size_t n = (sign ? 1 : 0) + numZeros + pad;
+  if (! left && ! zero) printRepeatTo(printer, ' ', pad);
+  if (sign) printer.write(sign);
+  if (zero) numZeros += pad;
+  while (numZeros-- > 0) printer.write('0');
+  n += printBody();
+  if (left) printRepeatTo(printer, ' ', pad);
+  return n;
+}
+
+/** Print an integer argument using the base selected by the conversion. */
+inline size_t printIntegerArgTo(
+    Print& printer, FormatSpec spec, const FormatArg& arg) {
+  uint8_t base;
+  switch (spec.conversion) {
+    case 'x': case 'X': base = 16; break;
+    case 'o': base = 8; break;
+    case 'b': base = 2; break;
+    default: base = 10;
+  }
+
+  char sign = '\0';
+  unsigned long u = arg.value.u;
+  if (arg.type != FormatArg::kTypeUint) {
+    if (base != 10) {
+      // Print the bit pattern of the original type, like printf().
+      if (arg.size < sizeof(unsigned long)) {
+        u &= (1UL << (8 * arg.size)) - 1;
+      }
+    } else if (arg.value.i < 0) {
+      sign = '-';
+      u = 0UL - u;
+    } else if (spec.flags & FormatSpec::kFlagPlus) {
+      sign = '+';
+    } else if (spec.flags & FormatSpec::kFlagSpace) {
+      sign = ' ';
+    }
+  }
+
+  // Digits are generated in reverse order at the end of the buffer.
+  char buf[sizeof(unsigned long) * 8];
+  char* end = buf + sizeof(buf);
+  char* p = end;
+  char hexBase = (spec.conversion == 'X') ? 'A' : 'a';
+  do {
+    uint8_t digit = u % base;
+    u /= base;
+    *--p = (digit < 10) ? '0' + digit : hexBase + digit - 10;
+  } while (u != 0);
+  size_t numDigits = end - p;
+
+  // An explicit precision is the minimum number of digits, and disables the
+  // '0' flag, like printf().
+  size_t numZeros = 0;
+  if (spec.precision >= 0) {
+    spec.flags &= ~FormatSpec::kFlagZero;
+    if ((size_t) spec.precision > numDigits) {
+      numZeros = spec.precision - numDigits;
+    }
+  }
+
+  return printFieldTo(printer, spec, sign, numZeros, numDigits,
+      [&printer, p, numDigits]() {
+        return printer.write((const uint8_t*) p, numDigits);
+      });
+}
+
+/** Print a floating point argument in fixed notation using Print::print(). */
+inline size_t printDoubleArgTo(
+    Print& printer, const FormatSpec& spec, double d) {
+  // Print::printFloat() takes the number of digits as a uint8_t.
+  int precision = (spec.precision < 0) ? 6
+      : (spec.precision > 255) ? 255
+      : spec.precision;
+
+  char sign = '\0';
+  if (d < 0) {
+    sign = '-';
+    d = -d;
+  } else if (spec.flags & FormatSpec::kFlagPlus) {
+    sign = '+';
+  } else if (spec.flags & FormatSpec::kFlagSpace) {
+    sign = ' ';
+  }
+
+  // Print::print(double) does not report its length in advance, so measure
+  // it first if padding is needed.
+  size_t bodyLength = 0;
+  if (spec.width > 0) {
+    CountingPrint counter;
+    bodyLength = counter.print(d, precision);
+  }
+
+  return printFieldTo(printer, spec, sign, 0, bodyLength,
+      [&printer, d, precision]() { return printer.print(d, precision); });
+}
+
+/** Print a string argument, truncated to the precision if given. */
+inline size_t printStringArgTo(
+    Print& printer, const FormatSpec& spec, const FormatArg& arg) {
+  const char* s = arg.value.s;
+  // An f-string is a normal pointer if ACE_COMMON_UNIFIED_FLASH.
+  bool isFlash = ! ACE_COMMON_UNIFIED_FLASH
+      && (arg.type == FormatArg::kTypeFstring);
+  if (s == nullptr) {
+    s = "(null)";
+    isFlash = false;
+  }
+
+  size_t length = isFlash ? strlen_P(s) : strlen(s);
+  if (spec.precision >= 0 && (size_t) spec.precision < length) {
+    length = spec.precision;
+  }
+
+  return printFieldTo(printer, spec, '\0', 0, length,
+      [&printer, s, isFlash, length]() {
+        if (isFlash) {
+          printRunTo(printer, FlashString((const __FlashStringHelper*) s),
+              length);
+        } else {
+          printRunTo(printer, s, length);
+        }
+        return length;
+      });
+}
+
+/** Print a single character. */
+inline size_t printCharArgTo(Print& printer, const FormatSpec& spec, char c) {
+  return printFieldTo(printer, spec, '\0', 0, 1,
+      [&printer, c]() { return printer.write(c); });
+}
+
+/**
+ * Print the argument according to its type. The conversion character selects
+ * the base of integers, and whether a char is printed as a character or as a
+ * number. Otherwise, the type of the argument determines how it is printed.
+ */
+inline size_t printArgTo(
+    Print& printer, const FormatSpec& spec, const FormatArg& arg) {
+  switch (arg.type) {
+    case FormatArg::kTypeCstring:
+    case FormatArg::kTypeFstring:
+      return printStringArgTo(printer, spec, arg);
+    case FormatArg::kTypeDouble:
+      return printDoubleArgTo(printer, spec, arg.value.d);
+    case FormatArg::kTypeChar:
+      if (spec.conversion == 'c' || spec.conversion == 's') {
+        return printCharArgTo(printer, spec, (char) arg.value.i);
+      }
+      return printIntegerArgTo(printer, spec, arg);
+    case FormatArg::kTypeInt:
+    case FormatArg::kTypeUint:
+      if (spec.conversion == 'c') {
+        return printCharArgTo(printer, spec, (char) arg.value.i);
+      }
+      return printIntegerArgTo(printer, spec, arg);
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Implementation of printFormatTo(), which parses the format string and
+ * prints the arguments in `args`. The runs of characters between the
+ * conversion specifications are sent using a single Print::write().
+ *
+ * @tparam T cstring-like type, a (const char*) or a FlashString
+ */
+template <typename T>
+size_t printFormatArgsTo(Print& printer, T fmt,
+    const FormatArg* args, uint8_t numArgs) {
+  size_t count = 0;
+  uint8_t argIndex = 0;
+  while (true) {
+    size_t n = findRunLength(fmt, '%');
+    printRunTo(printer, fmt, n);
+    count += n;
+    fmt += n;
+    if (*fmt == '\0') break;
+    fmt++;
+
+    char c = *fmt;
+    if (c == '%') {
+      fmt++;
+      count += printer.write('%');
+      continue;
+    }
+
+    FormatSpec spec;
+    spec.flags = 0;
+    spec.width = 0;
+    spec.precision = -1;
+    while (true) {
+      if (c == '-') spec.flags |= FormatSpec::kFlagLeft;
+      else if (c == '0') spec.flags |= FormatSpec::kFlagZero;
+      else if (c == '+') spec.flags |= FormatSpec::kFlagPlus;
+      else if (c == ' ') spec.flags |= FormatSpec::kFlagSpace;
+      else break;
+      c = *++fmt;
+    }
+    // The width and precision saturate at kMaxWidth instead of overflowing.
+    for (; c >= '0' && c <= '9'; c = *++fmt) {
+      spec.width = clampWidth(spec.width * 10L + (c - '0'));
+    }
+    if (c == '.') {
+      spec.precision = 0;
+      for (c = *++fmt; c >= '0' && c <= '9'; c = *++fmt) {
+        spec.precision = clampWidth(spec.precision * 10L + (c - '0'));
+      }
+    }
+    // Length modifiers are not needed, since the type of the argument is
+    // known, so they are skipped.
+    while (c == 'h' || c == 'l' || c == 'L' || c == 'j' || c == 'z'
+        || c == 't') {
+      c = *++fmt;
+    }
+    if (c == '\0') break;
+    fmt++;
+
+    spec.conversion = c;
+    if (argIndex < numArgs) {
+      count += printArgTo(printer, spec, args[argIndex++]);
+    }
+  }
+  return count;
+}
+
+} // internal
+
+/**
+ * Print the arguments to the `printer` according to the printf()-style format
+ * string `fmt`, without an intermediate buffer, so the output is never
+ * truncated. Unlike printfTo(), the type of each argument is known at compile
+ * time, so length modifiers like "%ld" are unnecessary (but accepted).
+ *
+ * Supported conversions:
+ *
+ *  * `%d`, `%i`, `%u`: decimal integer
+ *  * `%x`, `%X`, `%o`, `%b`: hexadecimal, octal, and binary integer
+ *  * `%c`: character
+ *  * `%s`: string in normal memory or in flash memory (using `F()`)
+ *  * `%f` (and `%e`, `%g`): floating point in fixed notation, using
+ *    Print::print(double, digits)
+ *  * `%%`: the '%' character
+ *
+ * along with the '-', '0', '+' and ' ' flags, the field width, and the
+ * precision. The width and precision are clamped to 32767, and the precision
+ * of a floating point number to 255. Arguments are printed according to their own type, so a string
+ * passed to "%d" is still printed as a string. Extra arguments are ignored,
+ * and missing arguments print nothing.
+ *
+ * Supported argument types are bool, char, integers up to `long` and
+ * `unsigned long`, float, double, `const char*` and `const
+ * __FlashStringHelper*`. Other types (e.g. `long long`, `String`) cause a
+ * compile-time error.
+ *
+ * @return number of characters printed
+ */
+template <typename... Args>
+size_t printFormatTo(Print& printer, const char* fmt, Args... args) {
+  // One extra element, so that the array is never empty.
+  const internal::FormatArg formatArgs[sizeof...(Args) + 1] = {args...};
+  return internal::printFormatArgsTo(
+      printer, fmt, formatArgs, sizeof...(Args));
+}
+
+/** Same as printFormatTo() with the format string in flash memory. */
+template <typename... Args>
+size_t printFormatTo(Print& printer, const __FlashStringHelper* fmt,
+    Args... args) {
+  const internal::FormatArg formatArgs[sizeof...(Args) + 1] = {args...};
+#if ACE_COMMON_UNIFIED_FLASH
+  return internal::printFormatArgsTo(
+      printer, (const char*) fmt, formatArgs, sizeof...(Args));
+#else
+  return internal::printFormatArgsTo(
+      printer, FlashString(fmt), formatArgs, sizeof...(Args));
+#endif
+}
+
+}
+
+#endif
@@ -22,32 +22,67 @@
 
 #include <stdint.h>
 #include <Print.h>
-#include "printPadTo.h"
+#include "formatUint.h"
 
 namespace ace_common {
 
+  /**
+   * Print the integer `value` as a fixed point number with `Decimals`
+   * digits after the decimal point, i.e. after dividing it by 10^Decimals.
+   * For example, `printFixedPointTo<3>(printer, -12345)` prints "-12.345",
+   * and `printFixedPointTo<6>(printer, micros64)` prints the seconds of a
+   * 64-bit microsecond counter. Does not use floating point operations. The
+   * result is formatted into a buffer on the stack, then sent using a single
+   * Print::write().
+   *
+   * @tparam Decimals number of digits after the decimal point, up to 19. If 0,
+   *    the decimal point is not printed.
+   * @tparam T type of the value, any signed or unsigned integer type up to 64
+   *    bits
+   */
+  template <uint8_t Decimals, typename T>
+  void printFixedPointTo(Print& printer, T value) {
+    static_assert(Decimals <= 19, "Decimals must be <= 19");
+    typedef typename internal::UnsignedOf<T>::type U;
+
+    // Room for the sign, the digits of the integer, and the decimal point.
+    // The fraction may have leading zeros beyond the digits of the integer.
+    const uint8_t kMaxDigits = sizeof(T) * 3 + 2;
+    char buf[kMaxDigits + Decimals];
+    char* end = buf + sizeof(buf);
+    char* p = end;
+
+    bool negative;
+    U magnitude = internal::toMagnitude(value, negative);
+    if (Decimals > 0) {
+      // If 10^Decimals does not fit into U, the whole number is the fraction.
+      const uint64_t kDivisor = internal::pow10(Decimals);
+      U whole = (kDivisor > (U) -1) ? 0 : magnitude / (U) kDivisor;
+      U frac = magnitude - whole * (U) kDivisor;
+      p = internal::formatUintBase<10>(p, frac);
+      while (end - p < Decimals) *--p = '0';
+      *--p = '.';
+      magnitude = whole;
+    }
+    p = internal::formatUintBase<10>(p, magnitude);
+    if (negative) *--p = '-';
+    printer.write((const uint8_t*) p, end - p);
+  }
+
   /**
    * Print a uint16 (e.g. 12345U) as a float after dividing by 1000 (i.e.
-   * "12.345").
+   * "12.345"). Same as printFixedPointTo<3>().
    */
   inline void printUint16AsFloat3To(Print& printer, uint16_t value) {
-    uint16_t whole = value / 1000;
-    uint16_t frac = value % 1000;
-    printer.print(whole);
-    printer.print('.');
-    printPad3To(printer, frac, '0');
+    printFixedPointTo<3>(printer, value);
   }
 
   /**
    * Print a uint32 (e.g. 123456UL) as a float after dividing by 1000 (i.e.
-   * "123.456").
+   * "123.456"). Same as printFixedPointTo<3>().
    */
   inline void printUint32AsFloat3To(Print& printer, uint32_t value) {
-    uint32_t whole = value / 1000;
-    uint16_t frac = value % 1000;
-    printer.print(whole);
-    printer.print('.');
-    printPad3To(printer, frac, '0');
+    printFixedPointTo<3>(printer, value);
   }
 }
 
@@ -8,7 +8,9 @@
  *
  * Various function that prints a `uint16_t` integer using N decimal places,
  * padded with a space or 0 character. For example, `printPad3To(Serial, 7,
- * '0')` will print "007" on the Serial monitor.
+ * '0')` will print "007" on the Serial monitor. The `printPadTo<Width,
+ * Base>()` template does the same for any unsigned or signed integer type,
+ * any width and any base from 2 to 16.
  */
 
 #ifndef ACE_COMMON_PRINT_PAD_TO_H
@@ -16,37 +18,80 @@
 
 #include <stdint.h>
 #include <Print.h>
+#include "formatUint.h"
 
 namespace ace_common {
 
+namespace internal {
+
+/**
+ * Print an unsigned integer right justified in a field of `width` characters
+ * (at most 5), using `padChar` on the left. The entire field is formatted
+ * into a buffer on the stack, then sent using a single Print::write().
+ */
+void printPadTo(Print& printer, uint16_t value, uint8_t width, char padChar);
+
+}
+
 /** Print an unsigned 2-digit integer to 'printer'. */
 inline void printPad2To(Print& printer, uint16_t value, char padChar = ' ') {
-  if (value < 10) printer.print(padChar);
-  printer.print(value);
+  internal::printPadTo(printer, value, 2, padChar);
 }
 
 /** Print an unsigned 3-digit integer to 'printer'. */
 inline void printPad3To(Print& printer, uint16_t val, char padChar = ' ') {
-  if (val < 100) printer.print(padChar);
-  if (val < 10) printer.print(padChar);
-  printer.print(val);
+  internal::printPadTo(printer, val, 3, padChar);
 }
 
 /** Print an unsigned 4-digit integer to 'printer'. */
 inline void printPad4To(Print& printer, uint16_t val, char padChar = ' ') {
-  if (val < 1000) printer.print(padChar);
-  if (val < 100) printer.print(padChar);
-  if (val < 10) printer.print(padChar);
-  printer.print(val);
+  internal::printPadTo(printer, val, 4, padChar);
 }
 
 /** Print an unsigned 5-digit integer to 'printer'. */
 inline void printPad5To(Print& printer, uint16_t val, char padChar = ' ') {
-  if (val < 10000) printer.print(padChar);
-  if (val < 1000) printer.print(padChar);
-  if (val < 100) printer.print(padChar);
-  if (val < 10) printer.print(padChar);
-  printer.print(val);
+  internal::printPadTo(printer, val, 5, padChar);
+}
+
+/**
+ * Print the integer `value` right justified in a field of `Width` characters,
+ * in the given `Base` (2 to 16), using `padChar` on the left. Values which are
+ * wider than the field are printed in full. A negative value is printed with
+ * a '-' sign, which is placed before the padding if `padChar` is '0' (like
+ * "%05d" of printf()), otherwise just before the digits. The entire field is
+ * formatted into a buffer on the stack, then sent using a single
+ * Print::write().
+ *
+ * For example:
+ *
+ * @code
+ * printPadTo<8>(printer, -123, '0'); // prints "-0000123"
+ * printPadTo<4, 16>(printer, (uint8_t) 0x2A, '0'); // prints "002A"
+ * printPadTo<20>(printer, micros64); // 64-bit counter
+ * @endcode
+ *
+ * @tparam Width minimum number of characters in the field, including the sign
+ * @tparam Base base of the number, 10 by default
+ * @tparam T type of the value, any signed or unsigned integer type up to 64
+ *    bits
+ */
+template <uint8_t Width, uint8_t Base = 10, typename T>
+void printPadTo(Print& printer, T value, char padChar = ' ') {
+  static_assert(Base >= 2 && Base <= 16, "Base must be between 2 and 16");
+
+  // Base 2 needs the most digits, plus 1 for the sign.
+  const uint8_t kMaxDigits = sizeof(T) * 8 + 1;
+  char buf[(Width > kMaxDigits) ? Width : kMaxDigits];
+  char* end = buf + sizeof(buf);
+
+  bool negative;
+  char* p = internal::formatUintBase<Base>(
+      end, internal::toMagnitude(value, negative));
+  uint8_t length = (end - p) + negative;
+  if (negative && padChar != '0') *--p = '-';
+  for (; length < Width; length++) *--p = padChar;
+  if (negative && padChar == '0') *--p = '-';
+  printer.write((const uint8_t*) p, end - p);
 }
 
 }
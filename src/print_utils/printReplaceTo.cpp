@@ -0,0 +1,57 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <Arduino.h> // memcpy_P(), strchr_P(), strlen_P()
+#include "printReplaceTo.h"
+
+namespace ace_common {
+namespace internal {
+
+/**
+ * Size of the buffer on the stack used to copy runs of characters from flash
+ * memory. Large enough to amortize the cost of the virtual Print::write(),
+ * small enough for the limited stack of an 8-bit processor.
+ */
+static const uint8_t kFlashRunBufferSize = 16;
+
+void printRunTo(Print& printer, FlashString s, size_t n) {
+  const char* p = (const char*) (const __FlashStringHelper*) s;
+  char buf[kFlashRunBufferSize];
+  while (n > 0) {
+    size_t len = (n < kFlashRunBufferSize) ? n : kFlashRunBufferSize;
+    memcpy_P(buf, p, len);
+    printer.write((const uint8_t*) buf, len);
+    p += len;
+    n -= len;
+  }
+}
+
+size_t findRunLength(FlashString s, char c) {
+  const char* p = (const char*) (const __FlashStringHelper*) s;
+  const char* q = strchr_P(p, c);
+  return (q == nullptr) ? strlen_P(p) : (size_t) (q - p);
+}
+
+}
+}
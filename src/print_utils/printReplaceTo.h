@@ -27,20 +27,59 @@ SOFTWARE.
  *
  * Functions that print strings from `src` to the given `Print` object while
  * replacing a given character with another character or another string.
+ *
+ * The characters between the replacements are found first, then sent to the
+ * `Print` object as a single run using `Print::write(buf, size)`, which is
+ * often much faster than calling `Print::write(c)` for each character.
  */
 
 #ifndef ACE_COMMON_PRINT_REPLACE_TO_H
 #define ACE_COMMON_PRINT_REPLACE_TO_H
 
 #include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+#include <string.h> // strchr(), strlen()
 #include <Print.h> // Print
 #include "../fstrings/FlashString.h"
+#include "../cstrings/CharReplacer.h"
+#include "../cstrings/PatternReplacer.h"
 
 class Print;
 class __FlashStringHelper;
 
 namespace ace_common {
 
+namespace internal {
+
+/**
+ * Print the `n` characters starting at `s` using a single call to
+ * Print::write(), instead of one call per character.
+ */
+inline void printRunTo(Print& printer, const char* s, size_t n) {
+  if (n > 0) printer.write((const uint8_t*) s, n);
+}
+
+/**
+ * Print the `n` characters starting at `s` in flash memory, by copying
+ * blocks of characters into a small buffer on the stack, then sending each
+ * block using a single call to Print::write().
+ */
+void printRunTo(Print& printer, FlashString s, size_t n);
+
+/**
+ * Return the number of characters starting at `s` before the first `c` or
+ * the terminating NUL.
+ */
+inline size_t findRunLength(const char* s, char c) {
+  const char* p = strchr(s, c);
+  return (p == nullptr) ? strlen(s) : (size_t) (p - s);
+}
+
+/** Version of findRunLength() for a string in flash memory. */
+size_t findRunLength(FlashString s, char c);
+
+}
+
 /**
  * Print the src to printer while replacing all occurrences of oldChar with
  * newChar. If newChar is '\0', then replace with nothing.
@@ -49,26 +88,32 @@ namespace ace_common {
  */
 template <typename T>
 void printReplaceCharTo(Print& printer, T src, char oldChar, char newChar) {
-  char c;
-  while ((c = *src++) != '\0') {
-    if (c == oldChar) {
-      if (newChar == '\0') continue;
-      c = newChar;
-    }
-    printer.write(c);
+  while (true) {
+    size_t n = internal::findRunLength(src, oldChar);
+    internal::printRunTo(printer, src, n);
+    src += n;
+    if (*src == '\0') break;
+    src++;
+    if (newChar != '\0') printer.write(newChar);
   }
 }
 
 /**
  * Version of printReplaceCharTo() that works for a (const __FlashStringHelper*)
- * by wrapping a FlashString around it.
+ * by wrapping a FlashString around it, or by casting it to a (const char*) if
+ * ACE_COMMON_UNIFIED_FLASH.
  */
 // 'inline' required, see https://stackoverflow.com/questions/4445654
 template<>
 inline void printReplaceCharTo<const __FlashStringHelper*>(
     Print& printer, const __FlashStringHelper* src,
     char oldChar, char newChar) {
+#if ACE_COMMON_UNIFIED_FLASH
+  printReplaceCharTo<const char*>(
+      printer, (const char*) src, oldChar, newChar);
+#else
   printReplaceCharTo<FlashString>(printer, FlashString(src), oldChar, newChar);
+#endif
 }
 
 /**
@@ -80,27 +125,127 @@ inline void printReplaceCharTo<const __FlashStringHelper*>(
 template <typename T>
 void printReplaceStringTo(
     Print& printer, T src, char oldChar, const char* newString) {
-  char c;
-  while ((c = *src++) != '\0') {
-    if (c == oldChar) {
-      printer.print(newString);
-    } else {
-      printer.write(c);
-    }
+  while (true) {
+    size_t n = internal::findRunLength(src, oldChar);
+    internal::printRunTo(printer, src, n);
+    src += n;
+    if (*src == '\0') break;
+    src++;
+    printer.print(newString);
   }
 }
 
 /**
  * Version of printReplaceCharTo() that works for a (const __FlashStringHelper*)
- * by wrapping a FlashString around it.
+ * by wrapping a FlashString around it, or by casting it to a (const char*) if
+ * ACE_COMMON_UNIFIED_FLASH.
  */
 // 'inline' required, see https://stackoverflow.com/questions/4445654
 template<>
 inline void printReplaceStringTo<const __FlashStringHelper*>(
     Print& printer, const __FlashStringHelper* src,
     char oldChar, const char* newString) {
+#if ACE_COMMON_UNIFIED_FLASH
+  printReplaceStringTo<const char*>(
+      printer, (const char*) src, oldChar, newString);
+#else
   printReplaceStringTo<FlashString>(
       printer, FlashString(src), oldChar, newString);
+#endif
+}
+
+/**
+ * Print the src to printer while replacing every character found in the
+ * `replacer` with its replacement string, in a single pass over `src`.
+ *
+ * @tparam T cstring-like type, a (const char*) or a FlashString
+ */
+template <typename T>
+void printReplaceCharsTo(
+    Print& printer, T src, const CharReplacer& replacer) {
+  while (true) {
+    T run = src;
+    size_t n = 0;
+    char c;
+    while ((c = *src) != '\0' && ! replacer.contains(c)) {
+      src++;
+      n++;
+    }
+    internal::printRunTo(printer, run, n);
+    if (c == '\0') break;
+    src++;
+    replacer.printReplacementTo(printer, c);
+  }
+}
+
+/**
+ * Version of printReplaceCharsTo() that works for a (const
+ * __FlashStringHelper*) by wrapping a FlashString around it, or by casting it
+ * to a (const char*) if ACE_COMMON_UNIFIED_FLASH.
+ */
+// 'inline' required, see https://stackoverflow.com/questions/4445654
+template<>
+inline void printReplaceCharsTo<const __FlashStringHelper*>(
+    Print& printer, const __FlashStringHelper* src,
+    const CharReplacer& replacer) {
+#if ACE_COMMON_UNIFIED_FLASH
+  printReplaceCharsTo<const char*>(printer, (const char*) src, replacer);
+#else
+  printReplaceCharsTo<FlashString>(printer, FlashString(src), replacer);
+#endif
+}
+
+/**
+ * Print the src to printer while replacing every occurrence of the patterns in
+ * the `replacer` with their replacement strings, in a single pass over `src`.
+ * See PatternReplacerBase for the rules used when patterns overlap.
+ *
+ * The characters which may be the beginning of a pattern are not printed
+ * until the automaton determines that they are not part of a match. They are
+ * not buffered, but read again from `src` and printed as a single run, so no
+ * extra memory is needed.
+ *
+ * @tparam T cstring-like type, a (const char*) or a FlashString
+ */
+template <typename T>
+void printReplacePatternsTo(
+    Print& printer, T src, const PatternReplacerBase& replacer) {
+  T pending = src;
+  size_t numPending = 0;
+  uint8_t state = 0;
+  char c;
+  while ((c = *src++) != '\0') {
+    state = replacer.next(state, c);
+    numPending++;
+
+    uint8_t length = replacer.getMatchLength(state);
+    if (length > 0) {
+      internal::printRunTo(printer, pending, numPending - length);
+      replacer.printReplacementTo(printer, state);
+      pending = src;
+      numPending = 0;
+      state = 0;
+    }
+  }
+
+  internal::printRunTo(printer, pending, numPending);
+}
+
+/**
+ * Version of printReplacePatternsTo() that works for a (const
+ * __FlashStringHelper*) by wrapping a FlashString around it, or by casting it
+ * to a (const char*) if ACE_COMMON_UNIFIED_FLASH.
+ */
+// 'inline' required, see https://stackoverflow.com/questions/4445654
+template<>
+inline void printReplacePatternsTo<const __FlashStringHelper*>(
+    Print& printer, const __FlashStringHelper* src,
+    const PatternReplacerBase& replacer) {
+#if ACE_COMMON_UNIFIED_FLASH
+  printReplacePatternsTo<const char*>(printer, (const char*) src, replacer);
+#else
+  printReplacePatternsTo<FlashString>(printer, FlashString(src), replacer);
+#endif
 }
 
 } // ace_common
@@ -33,8 +33,13 @@
 #ifndef ACE_COMMON_PRINTF_TO_H
 #define ACE_COMMON_PRINTF_TO_H
 
-#include <stdio.h> // vsnprintf()
+#include <stdio.h> // vsnprintf(), vfprintf()
+#include <stddef.h> // size_t, ptrdiff_t
+#include <stdint.h> // intmax_t
+#include <string.h> // strchr(), strlen()
+#include <ctype.h> // isxdigit()
 #include <stdarg.h> // va_list, va_start(), va_end()
+#include <Print.h>
 
 class Print;
 
@@ -63,6 +68,353 @@ inline void printfTo(Print& printer, const char* fmt, ...) {
   va_end(args);
 }
 
+/** Size of the chunks used by printfToUnbounded(). */
+const int PRINTF_TO_CHUNK_SIZE = 32;
+
+// Set to 1 if vprintfToUnbounded() can stream the output of vfprintf() into
+// the Print object through a custom stdio stream (AVR, glibc, MacOS). Set to
+// 0 to format each conversion separately into a small buffer on the stack,
+// which needs only vsnprintf().
+#ifndef ACE_COMMON_PRINTF_TO_STREAM
+  #if defined(ARDUINO_ARCH_AVR) || defined(__GLIBC__) || defined(__APPLE__)
+    #define ACE_COMMON_PRINTF_TO_STREAM 1
+  #else
+    #define ACE_COMMON_PRINTF_TO_STREAM 0
+  #endif
+#endif
+
+namespace internal {
+
+#if ! ACE_COMMON_PRINTF_TO_STREAM
+
+/** Write `count` copies of the character `c` to the `printer`. */
+inline void printfToRepeat(Print& printer, char c, size_t count) {
+  for (; count > 0; count--) printer.write(c);
+}
+
+/**
+ * Format the argument of the conversion `spec` (without its width) into
+ * `buf` using snprintf(), consuming the argument from `*args`.
+ *
+ * @return the return value of snprintf(), or -1 if the conversion is not
+ *    supported
+ */
+inline int printfToFormat(char* buf, size_t size, const char* spec,
+    char conversion, char modifier, va_list* args) {
+  switch (conversion) {
+    case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+      switch (modifier) {
+        case 'l': return snprintf(buf, size, spec, va_arg(*args, long));
+        case 'q': return snprintf(buf, size, spec, va_arg(*args, long long));
+        case 'j': return snprintf(buf, size, spec, va_arg(*args, intmax_t));
+        case 'z': return snprintf(buf, size, spec, va_arg(*args, size_t));
+        case 't': return snprintf(buf, size, spec, va_arg(*args, ptrdiff_t));
+        default: return snprintf(buf, size, spec, va_arg(*args, int));
+      }
+
+    case 'c':
+      return snprintf(buf, size, spec, va_arg(*args, int));
+
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a':
+    case 'A':
+      if (modifier == 'L') {
+        return snprintf(buf, size, spec, va_arg(*args, long double));
+      } else {
+        return snprintf(buf, size, spec, va_arg(*args, double));
+      }
+
+    case 'p':
+      return snprintf(buf, size, spec, va_arg(*args, void*));
+
+    default: // including "%n", which is not supported
+      return -1;
+  }
+}
+
+/**
+ * Write the formatted `body` of `length` characters of a conversion, padded
+ * to `width` characters. The '0' flag inserts the zeros after the sign and
+ * the "0x" prefix, like printf(), except for "inf" and "nan".
+ *
+ * @return the number of characters written
+ */
+inline size_t printfToPadded(Print& printer, const char* body, size_t length,
+    size_t width, bool leftAlign, bool zeroPad) {
+  size_t pad = (width > length) ? width - length : 0;
+  if (leftAlign) {
+    printer.write((const uint8_t*) body, length);
+    printfToRepeat(printer, ' ', pad);
+  } else if (zeroPad) {
+    size_t prefix = (length > 0 && strchr("+- ", body[0]) != nullptr) ? 1 : 0;
+    if (prefix + 1 < length && body[prefix] == '0'
+        && (body[prefix + 1] == 'x' || body[prefix + 1] == 'X')) {
+      prefix += 2;
+    }
+    // The digits of "inf" and "nan" are not hex digits.
+    if (prefix < length && isxdigit(body[prefix])) {
+      printer.write((const uint8_t*) body, prefix);
+      printfToRepeat(printer, '0', pad);
+      printer.write((const uint8_t*) body + prefix, length - prefix);
+    } else {
+      printfToRepeat(printer, ' ', pad);
+      printer.write((const uint8_t*) body, length);
+    }
+  } else {
+    printfToRepeat(printer, ' ', pad);
+    printer.write((const uint8_t*) body, length);
+  }
+  return length + pad;
+}
+
+/**
+ * Format the single conversion specification which starts at the '%' of
+ * `*fmt` using snprintf(), consuming its argument (and the arguments of any
+ * '*' width or precision) from `*args`, and write the result to `printer`.
+ * Advance `*fmt` past the specification.
+ *
+ * The width is not passed to snprintf(). The conversion is formatted without
+ * it, then padded by printfToPadded(), so that a wide field does not need a
+ * large buffer. A "%s" is written directly. Any other conversion is formatted
+ * into a buffer of PRINTF_TO_CHUNK_SIZE on the stack, or formatted a second
+ * time into a buffer of the exact size if it does not fit (e.g. a "%f" of a
+ * very large number, or a very large precision).
+ *
+ * @return the number of characters written, or -1 if the specification is
+ *    invalid or not supported
+ */
+inline int printfToConversion(
+    Print& printer, const char** fmt, va_list* args) {
+  const char* p = *fmt + 1;
+  char spec[24];
+  size_t i = 0;
+  spec[i++] = '%';
+
+  // Flags. The '-' and '0' flags are applied by printfToPadded().
+  bool leftAlign = false;
+  bool zeroPad = false;
+  while (*p != '\0' && strchr("-+ #0", *p) != nullptr) {
+    if (*p == '-') {
+      leftAlign = true;
+    } else if (*p == '0') {
+      zeroPad = true;
+    } else if (i < 4) {
+      spec[i++] = *p;
+    }
+    p++;
+  }
+
+  // Width, with '*' replaced by the value of the argument.
+  const int kMaxWidth = 0x7FFF;
+  int width = 0;
+  if (*p == '*') {
+    width = va_arg(*args, int);
+    if (width < 0) {
+      leftAlign = true;
+      width = (width < -kMaxWidth) ? kMaxWidth : -width;
+    }
+    p++;
+  } else {
+    while (*p >= '0' && *p <= '9') {
+      if (width <= kMaxWidth) width = width * 10 + (*p - '0');
+      p++;
+    }
+  }
+  if (width > kMaxWidth) width = kMaxWidth;
+
+  // Precision, ignored if negative.
+  int precision = -1;
+  if (*p == '.') {
+    p++;
+    if (*p == '*') {
+      precision = va_arg(*args, int);
+      p++;
+    } else {
+      precision = 0;
+      while (*p >= '0' && *p <= '9') {
+        if (precision <= kMaxWidth) precision = precision * 10 + (*p - '0');
+        p++;
+      }
+    }
+    if (precision > kMaxWidth) precision = kMaxWidth;
+    if (precision >= 0) {
+      i += snprintf(spec + i, sizeof(spec) - i, ".%d", precision);
+    }
+  }
+
+  // Length modifier, 'H' for "hh" and 'q' for "ll".
+  char modifier = '\0';
+  while (*p != '\0' && strchr("hlLjzt", *p) != nullptr) {
+    modifier = (modifier == *p) ? ((*p == 'h') ? 'H' : 'q') : *p;
+    if (i < sizeof(spec) - 2) spec[i++] = *p;
+    p++;
+  }
+
+  char conversion = *p;
+  if (conversion == '\0') return -1;
+  spec[i++] = conversion;
+  spec[i] = '\0';
+  *fmt = p + 1;
+
+  // The '0' flag applies to the numbers only, and is ignored by the integer
+  // conversions if a precision is given.
+  if (strchr("diouxX", conversion) != nullptr) {
+    if (precision >= 0) zeroPad = false;
+  } else if (strchr("fFeEgGaA", conversion) == nullptr) {
+    zeroPad = false;
+  }
+
+  switch (conversion) {
+    case '%':
+      printer.write('%');
+      return 1;
+
+    case 's': {
+      const char* s = va_arg(*args, const char*);
+      if (s == nullptr) s = "(null)";
+      size_t length = 0;
+      while (s[length] != '\0'
+          && (precision < 0 || length < (size_t) precision)) {
+        length++;
+      }
+      return printfToPadded(printer, s, length, width, leftAlign, false);
+    }
+  }
+
+  va_list saved;
+  va_copy(saved, *args);
+  char buf[PRINTF_TO_CHUNK_SIZE];
+  int n = printfToFormat(buf, sizeof(buf), spec, conversion, modifier, args);
+  if (n >= (int) sizeof(buf)) {
+    // Too long for the small buffer, so format it again into a buffer of the
+    // exact size. Its size is bounded by the precision and the largest
+    // number, but not by the width.
+    char big[n + 1];
+    printfToFormat(big, n + 1, spec, conversion, modifier, &saved);
+    n = printfToPadded(printer, big, n, width, leftAlign, zeroPad);
+  } else if (n >= 0) {
+    n = printfToPadded(printer, buf, n, width, leftAlign, zeroPad);
+  }
+  va_end(saved);
+  return n;
+}
+
+#elif defined(ARDUINO_ARCH_AVR)
+
+/** The `put()` function of the avr-libc stdio stream of vprintfToUnbounded(). */
+inline int printfToPut(char c, FILE* stream) {
+  Print* printer = (Print*) fdev_get_udata(stream);
+  printer->write(c);
+  return 0;
+}
+
+#elif defined(__GLIBC__)
+
+/** The `write()` function of the fopencookie() stream. */
+inline ssize_t printfToWrite(void* cookie, const char* buf, size_t size) {
+  ((Print*) cookie)->write((const uint8_t*) buf, size);
+  // Always report success, so that the formatting continues even if the
+  // Print object has run out of room.
+  return size;
+}
+
+#elif defined(__APPLE__)
+
+/** The `write()` function of the funopen() stream. */
+inline int printfToWrite(void* cookie, const char* buf, int size) {
+  ((Print*) cookie)->write((const uint8_t*) buf, size);
+  return size;
+}
+
+#endif
+
+}
+
+/**
+ * Version of vprintfTo() which is not limited to PRINTF_TO_BUF_SIZE
+ * characters. The output is streamed to the `printer` in small pieces, so
+ * that the stack usage does not depend on the length of the output, and no
+ * memory is allocated on the heap:
+ *
+ *  * On AVR, a stdio stream is created on the stack whose `put()` function
+ *    writes each character to the `printer`.
+ *  * On Linux (glibc) and MacOS (e.g. EpoxyDuino), a stdio stream is created
+ *    using fopencookie() or funopen(), with a buffer of PRINTF_TO_CHUNK_SIZE
+ *    on the stack.
+ *  * On other platforms (or if ACE_COMMON_PRINTF_TO_STREAM is 0), the
+ *    literal text of `fmt` is written directly, and each conversion is
+ *    formatted separately by snprintf() into a buffer of PRINTF_TO_CHUNK_SIZE
+ *    on the stack, then padded to its width. A conversion which does not fit
+ *    (e.g. a "%f" of a very large number) is formatted again into a buffer of
+ *    its exact size on the stack. Nothing is truncated. The "%n" conversion
+ *    is not supported. (The funopen() and fopencookie() of newlib allocate
+ *    the stream on the heap, so they are not used.)
+ *
+ * @return the number of characters written to the `printer`, or a negative
+ *    number if an error occurred (e.g. an invalid format string)
+ */
+inline int vprintfToUnbounded(Print& printer, const char *fmt, va_list args) {
+#if ! ACE_COMMON_PRINTF_TO_STREAM
+  va_list args2;
+  va_copy(args2, args);
+  int total = 0;
+  while (true) {
+    const char* percent = strchr(fmt, '%');
+    size_t length = (percent == nullptr) ? strlen(fmt) : percent - fmt;
+    if (length > 0) printer.write((const uint8_t*) fmt, length);
+    total += length;
+    if (percent == nullptr) break;
+
+    fmt = percent;
+    int n = internal::printfToConversion(printer, &fmt, &args2);
+    if (n < 0) {
+      total = n;
+      break;
+    }
+    total += n;
+  }
+  va_end(args2);
+  return total;
+
+#elif defined(ARDUINO_ARCH_AVR)
+  FILE stream;
+  fdev_setup_stream(&stream, internal::printfToPut, nullptr, _FDEV_SETUP_WRITE);
+  fdev_set_udata(&stream, &printer);
+  return vfprintf(&stream, fmt, args);
+
+#else
+  #if defined(__GLIBC__)
+    cookie_io_functions_t functions = {
+        nullptr, internal::printfToWrite, nullptr, nullptr};
+    FILE* stream = fopencookie(&printer, "w", functions);
+  #else
+    FILE* stream = funopen(
+        &printer, nullptr, internal::printfToWrite, nullptr, nullptr);
+  #endif
+  if (stream == nullptr) return -1;
+
+  char buf[PRINTF_TO_CHUNK_SIZE];
+  setvbuf(stream, buf, _IOFBF, PRINTF_TO_CHUNK_SIZE);
+  int n = vfprintf(stream, fmt, args);
+  fclose(stream);
+  return n;
+#endif
+}
+
+/**
+ * Version of printfTo() which is not limited to PRINTF_TO_BUF_SIZE
+ * characters. See vprintfToUnbounded() for details.
+ *
+ * @return the number of characters in the output, or a negative number if an
+ *    error occurred
+ */
+inline int printfToUnbounded(Print& printer, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vprintfToUnbounded(printer, fmt, args);
+  va_end(args);
+  return n;
+}
+
 }
 
 #endif
@@ -23,7 +23,9 @@ SOFTWARE.
 */
 
 #include <stdint.h>
+#include <string.h> // strcmp(), strchr(), strrchr()
 #include <Arduino.h>
+#include "../fstrings/FlashStringReader.h"
 #include "pstrings.h"
 
 namespace ace_common {
@@ -33,38 +35,52 @@ int strcmp_PP(const char* a, const char* b) {
   if (a == nullptr) { return -1; }
   if (b == nullptr) { return 1; }
 
+#if ACE_COMMON_UNIFIED_FLASH
+  return strcmp(a, b);
+#else
+  FlashStringReader aa((const __FlashStringHelper*) a);
+  FlashStringReader bb((const __FlashStringHelper*) b);
   while (true) {
-    uint8_t ca = pgm_read_byte(a);
-    uint8_t cb = pgm_read_byte(b);
+    uint8_t ca = *aa++;
+    uint8_t cb = *bb++;
     if (ca != cb) return (int) ca - (int) cb;
     if (ca == '\0') return 0;
-    a++;
-    b++;
   }
+#endif
 }
 
 #if defined(ESP8266) || defined(ESP32)
 
 const char* strchr_P(const char* s, int c) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strchr(s, c);
+#else
   char cc = c;
+  FlashStringReader r((const __FlashStringHelper*) s);
   while (true) {
-    char d = pgm_read_byte(s);
-    if (cc == d) return s;
+    char d = *r;
+    if (cc == d) return (const char*) (const void*) r;
     if (!d) return nullptr;
-    s++;
+    ++r;
   }
+#endif
 }
 
 const char* strrchr_P(const char* s, int c) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strrchr(s, c);
+#else
   char cc = c;
   const char* found = nullptr;
+  FlashStringReader r((const __FlashStringHelper*) s);
   while (true) {
-    char d = pgm_read_byte(s);
-    if (cc == d) found = s;
+    char d = *r;
+    if (cc == d) found = (const char*) (const void*) r;
     if (!d) break;
-    s++;
+    ++r;
   }
   return found;
+#endif
 }
 
 #endif
@@ -0,0 +1,219 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_CONCURRENT_TIMING_STATS_H
+#define ACE_COMMON_CONCURRENT_TIMING_STATS_H
+
+#include <stdint.h>
+#include <Arduino.h> // xPortGetCoreID(), get_core_num()
+#include "TimingStats.h"
+
+// Size in bytes of the cache line of the processors whose cores can update
+// different shards of a ConcurrentTimingStats at the same time. Each shard is
+// aligned and padded to this size, so that 2 writers on different cores do
+// not keep invalidating the same cache line ("false sharing"). Set to 0 on
+// the single-core microcontrollers, where the writers are interrupts which
+// cannot run at the same time, to avoid wasting RAM on the padding.
+#ifndef ACE_COMMON_CACHE_LINE_SIZE
+  #if defined(__APPLE__) && defined(__aarch64__)
+    #define ACE_COMMON_CACHE_LINE_SIZE 128
+  #elif defined(EPOXY_DUINO) || defined(__linux__) || defined(__APPLE__)
+    #define ACE_COMMON_CACHE_LINE_SIZE 64
+  #elif defined(ESP32)
+    #define ACE_COMMON_CACHE_LINE_SIZE 32
+  #else
+    #define ACE_COMMON_CACHE_LINE_SIZE 0
+  #endif
+#endif
+
+namespace ace_common {
+
+#if defined(ESP32) || defined(ARDUINO_ARCH_RP2040)
+
+/**
+ * Return the number of the CPU core which runs the caller. It can be passed
+ * as the shard of ConcurrentTimingStats::update() if each core has a single
+ * writer, i.e. no ISR updates the same statistics. Defined only on the
+ * dual-core processors (ESP32, RP2040), because it would return the same
+ * shard for every writer on the others.
+ */
+inline uint8_t currentCoreId() {
+#if defined(ESP32)
+  return (uint8_t) xPortGetCoreID();
+#else
+  return (uint8_t) get_core_num();
+#endif
+}
+
+#endif
+
+/**
+ * A version of TimingStatsT which can be updated from interrupt service
+ * routines, from several cores (e.g. ESP32), or from several threads (e.g.
+ * Linux), while it is read from somewhere else, without locks.
+ *
+ * The statistics are split into `NumShards` shards. Each shard must be
+ * updated by only one writer at a time, for example one shard per core, one
+ * shard per thread, or one shard for an ISR and another for the `loop()`. The
+ * caller always passes the shard to update(), because only the caller knows
+ * which writer it is. Each shard is padded to ACE_COMMON_CACHE_LINE_SIZE, so
+ * an instance should be allocated statically or on the stack, since
+ * `operator new` does not honor the alignment before C++17.
+ * Each shard is protected by a sequence counter (a "seqlock"): the writer
+ * makes the counter odd before it modifies the shard, and even again after.
+ * A reader copies the shard, then retries if the counter was odd or has
+ * changed during the copy. The writers never wait for the readers, so
+ * update() takes a constant time in the hot path.
+ *
+ * The getSnapshot() method merges the consistent copies of all the shards
+ * using TimingStatsT::merge(). Each shard is consistent by itself, but the
+ * shards are copied one after another, not at the same instant.
+ *
+ * The reset() method does not modify the shards, because that would make the
+ * reader a second writer. It sets a flag in each shard instead, which is
+ * applied by the next update() of that shard. Until then, the shard is
+ * treated as empty by readShard() and getSnapshot().
+ *
+ * @tparam NumShards number of independent writers
+ * @tparam S unsigned type of the duration (default uint32_t)
+ * @tparam Sum unsigned type of the sum of the durations (default uint64_t)
+ * @tparam C unsigned type of the number of samples (default uint32_t)
+ */
+template <
+    uint8_t NumShards,
+    typename S = uint32_t,
+    typename Sum = uint64_t,
+    typename C = uint32_t>
+class ConcurrentTimingStats {
+  public:
+    /** The type of the statistics in each shard, and of the snapshot. */
+    typedef TimingStatsT<S, Sum, C> Stats;
+
+#if defined(ARDUINO_ARCH_AVR)
+    // A single byte is read and written atomically on 8-bit processors.
+    typedef uint8_t Sequence;
+#else
+    typedef uint32_t Sequence;
+#endif
+
+    /** Constructor. */
+    ConcurrentTimingStats() {
+      for (uint8_t i = 0; i < NumShards; i++) {
+        mShards[i].sequence = 0;
+        mShards[i].resetRequested = false;
+      }
+    }
+
+    /**
+     * Add the given duration to the given `shard`, which must not be updated
+     * concurrently by another writer. For example, pass a fixed shard for the
+     * ISR and another for the `loop()`, the index of each thread, or
+     * `currentCoreId()` on a dual-core processor with one writer per core.
+     */
+    void update(S duration, uint8_t shard) {
+      Shard& s = mShards[shard];
+      Sequence sequence = __atomic_load_n(&s.sequence, __ATOMIC_RELAXED);
+      __atomic_store_n(&s.sequence, (Sequence) (sequence + 1),
+          __ATOMIC_RELAXED);
+      __atomic_thread_fence(__ATOMIC_RELEASE);
+
+      if (__atomic_load_n(&s.resetRequested, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&s.resetRequested, false, __ATOMIC_RELAXED);
+        s.stats.reset();
+      }
+      s.stats.update(duration);
+
+      __atomic_store_n(&s.sequence, (Sequence) (sequence + 2),
+          __ATOMIC_RELEASE);
+    }
+
+    /**
+     * Copy a consistent version of the statistics of the given `shard` into
+     * `stats`. Retries while the shard is being updated, so this must not be
+     * called from a context which prevents the writer of the shard from
+     * running (e.g. from an ISR, if the shard is updated by the main loop).
+     */
+    void readShard(uint8_t shard, Stats& stats) const {
+      const Shard& s = mShards[shard];
+      while (true) {
+        Sequence before = __atomic_load_n(&s.sequence, __ATOMIC_ACQUIRE);
+        if (before & 0x1) continue;
+
+        bool resetRequested = __atomic_load_n(
+            &s.resetRequested, __ATOMIC_RELAXED);
+        stats = s.stats;
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        Sequence after = __atomic_load_n(&s.sequence, __ATOMIC_RELAXED);
+        if (before == after) {
+          // The counter is preserved by reset().
+          if (resetRequested) stats.reset();
+          return;
+        }
+      }
+    }
+
+    /** Return the statistics of all the shards merged together. */
+    Stats getSnapshot() const {
+      Stats snapshot;
+      Stats shardStats;
+      for (uint8_t i = 0; i < NumShards; i++) {
+        readShard(i, shardStats);
+        snapshot.merge(shardStats);
+      }
+      return snapshot;
+    }
+
+    /**
+     * Request each shard to be reset by its writer on its next update(),
+     * except for the counter which is never reset.
+     */
+    void reset() {
+      for (uint8_t i = 0; i < NumShards; i++) {
+        __atomic_store_n(&mShards[i].resetRequested, true, __ATOMIC_RELAXED);
+      }
+    }
+
+  private:
+#if ACE_COMMON_CACHE_LINE_SIZE > 0
+    struct alignas(ACE_COMMON_CACHE_LINE_SIZE) Shard {
+#else
+    struct Shard {
+#endif
+      Sequence sequence;
+      bool resetRequested;
+      Stats stats;
+    };
+
+    // Disable copy-constructor and assignment operator, because the shards
+    // cannot be copied consistently.
+    ConcurrentTimingStats(const ConcurrentTimingStats&) = delete;
+    ConcurrentTimingStats& operator=(const ConcurrentTimingStats&) = delete;
+
+    Shard mShards[NumShards];
+};
+
+}
+
+#endif
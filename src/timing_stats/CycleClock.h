@@ -0,0 +1,175 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_CYCLE_CLOCK_H
+#define ACE_COMMON_CYCLE_CLOCK_H
+
+#include <stdint.h>
+#include <Arduino.h> // micros(), ESP.getCycleCount()
+#if defined(EPOXY_DUINO) || defined(__linux__) || defined(__APPLE__)
+  #include <time.h> // clock_gettime()
+#endif
+
+namespace ace_common {
+
+/**
+ * A clock source for ScopedTimerT and the benchmarks, which counts in
+ * microseconds using `micros()`. The resolution is 4 micros on 16 MHz AVR
+ * processors.
+ *
+ * A clock source is a class with the following static methods:
+ *
+ *  * `void begin()`: enable the clock, if necessary
+ *  * `uint32_t now()`: the current number of ticks, which wraps around
+ *  * `uint32_t ticksPerMicro()`: the number of ticks in one microsecond
+ */
+class MicrosClock {
+  public:
+    /** True if the ticks are CPU cycles. */
+    static const bool kIsCycleCounter = false;
+
+    /** Nothing to do. */
+    static void begin() {}
+
+    /** Return the current micros. */
+    static uint32_t now() { return micros(); }
+
+    /** Return 1. */
+    static uint32_t ticksPerMicro() { return 1; }
+
+    /** Convert the given number of ticks into micros. */
+    static uint32_t toMicros(uint32_t ticks) { return ticks; }
+
+    /**
+     * Convert the given number of ticks into nanos, saturated to UINT32_MAX
+     * for intervals longer than about 4.29 seconds.
+     */
+    static uint32_t toNanos(uint32_t ticks) {
+      uint64_t nanos = (uint64_t) ticks * 1000;
+      return (nanos > UINT32_MAX) ? UINT32_MAX : (uint32_t) nanos;
+    }
+};
+
+/**
+ * A clock source with the highest resolution available on the processor,
+ * which can time individual calls of short functions:
+ *
+ *  * ARM Cortex-M3, M4, M7 and M33: the CPU cycles counted by the `CYCCNT`
+ *    register of the Data Watchpoint and Trace (DWT) unit, which is enabled
+ *    by `begin()`
+ *  * ESP8266 and ESP32: the CPU cycles counted by the `ccount` register,
+ *    through `ESP.getCycleCount()`
+ *  * Linux and MacOS (EpoxyDuino): nanoseconds of `clock_gettime()` with
+ *    `CLOCK_MONOTONIC`, which does not depend on the TSC frequency, unlike
+ *    `rdtsc`
+ *  * other processors (AVR, Cortex-M0+): fall back to `micros()`
+ *
+ * The 32-bit counter wraps around after 2^32 ticks (e.g. 17.9 seconds at
+ * 240 MHz, or 4.29 seconds on Linux), so the durations must be shorter than
+ * that.
+ */
+class CycleClock {
+  public:
+  #if defined(__ARM_ARCH_7M__) \
+      || defined(__ARM_ARCH_7EM__) \
+      || defined(__ARM_ARCH_8M_MAIN__)
+
+    static const bool kIsCycleCounter = true;
+
+    /** Enable the DWT cycle counter. */
+    static void begin() {
+      *(volatile uint32_t*) 0xE000EDFC |= 0x01000000; // DEMCR.TRCENA
+      *(volatile uint32_t*) 0xE0001FB0 = 0xC5ACCE55; // DWT.LAR, Cortex-M7
+      *(volatile uint32_t*) 0xE0001000 |= 0x00000001; // DWT.CTRL.CYCCNTENA
+    }
+
+    /** Return the current CPU cycle count. */
+    static uint32_t now() { return *(volatile uint32_t*) 0xE0001004; }
+
+    /** Return the number of CPU cycles per microsecond. */
+    static uint32_t ticksPerMicro() { return F_CPU / 1000000; }
+
+  #elif defined(ESP8266) || defined(ESP32)
+
+    static const bool kIsCycleCounter = true;
+
+    /** Nothing to do. */
+    static void begin() {}
+
+    /** Return the current CPU cycle count. */
+    static uint32_t now() { return ESP.getCycleCount(); }
+
+    /** Return the number of CPU cycles per microsecond. */
+    static uint32_t ticksPerMicro() { return ESP.getCpuFreqMHz(); }
+
+  #elif defined(EPOXY_DUINO) || defined(__linux__) || defined(__APPLE__)
+
+    static const bool kIsCycleCounter = false;
+
+    /** Nothing to do. */
+    static void begin() {}
+
+    /** Return the current nanos of the monotonic clock. */
+    static uint32_t now() {
+      struct timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      return (uint32_t) ts.tv_sec * 1000000000UL + (uint32_t) ts.tv_nsec;
+    }
+
+    /** Return 1000. */
+    static uint32_t ticksPerMicro() { return 1000; }
+
+  #else
+
+    static const bool kIsCycleCounter = false;
+
+    /** Nothing to do. */
+    static void begin() {}
+
+    /** Return the current micros. */
+    static uint32_t now() { return micros(); }
+
+    /** Return 1. */
+    static uint32_t ticksPerMicro() { return 1; }
+
+  #endif
+
+    /** Convert the given number of ticks into micros. */
+    static uint32_t toMicros(uint32_t ticks) {
+      return ticks / ticksPerMicro();
+    }
+
+    /**
+     * Convert the given number of ticks into nanos, saturated to UINT32_MAX
+     * for intervals longer than about 4.29 seconds.
+     */
+    static uint32_t toNanos(uint32_t ticks) {
+      uint64_t nanos = (uint64_t) ticks * 1000 / ticksPerMicro();
+      return (nanos > UINT32_MAX) ? UINT32_MAX : (uint32_t) nanos;
+    }
+};
+
+}
+
+#endif
@@ -26,25 +26,129 @@ SOFTWARE.
 #define ACE_COMMON_GENERIC_STATS_H
 
 #include <stdint.h>
+#include <math.h> // sqrt()
+#include "../print_utils/formatUint.h" // internal::UnsignedOf
 
 namespace ace_common {
 
+namespace internal {
+
+/**
+ * Move the exponential decay average `avg` towards `value` by 1/2^shift of
+ * their difference, for an integer type T. The difference is always
+ * calculated as a positive number in the unsigned type of the same size, so
+ * that it can be shifted instead of divided, and so that it does not overflow
+ * for a signed T (e.g. 100 - (-100) for an int8_t). The result lies between
+ * `avg` and `value`, so it fits back into T.
+ */
+template <typename T>
+T updateExpDecayAvg(T avg, T value, uint8_t shift) {
+  typedef typename UnsignedOf<T>::type U;
+  if (value >= avg) {
+    U diff = (U) ((U) value - (U) avg);
+    return (T) (U) ((U) avg + (U) (diff >> shift));
+  } else {
+    U diff = (U) ((U) avg - (U) value);
+    return (T) (U) ((U) avg - (U) (diff >> shift));
+  }
+}
+
+/** Version of updateExpDecayAvg() for float. */
+inline float updateExpDecayAvg(float avg, float value, uint8_t shift) {
+  return avg + (value - avg) / (float) ((uint32_t) 1 << shift);
+}
+
+/** Version of updateExpDecayAvg() for double. */
+inline double updateExpDecayAvg(double avg, double value, uint8_t shift) {
+  return avg + (value - avg) / (double) ((uint32_t) 1 << shift);
+}
+
+/**
+ * Running mean and sum of squared differences from the mean, updated using
+ * Welford's online algorithm, used by GenericStats when its `Variance`
+ * parameter is true. It keeps its own count, which never wraps to 0 (it
+ * saturates instead), so that the division by the count is always valid, even
+ * when the (usually 16-bit) count of GenericStats wraps around.
+ */
+template <bool Enabled>
+class VarianceAccumulator {
+  protected:
+    void resetVariance() {
+      mMean = 0;
+      mM2 = 0;
+      mVarianceCount = 0;
+    }
+
+    template <typename T>
+    void updateVariance(T value) {
+      if (mVarianceCount < UINT32_MAX) mVarianceCount++;
+      double x = (double) value;
+      double delta = x - mMean;
+      mMean += delta / (double) mVarianceCount;
+      mM2 += delta * (x - mMean);
+    }
+
+    double mMean;
+    double mM2;
+    uint32_t mVarianceCount;
+};
+
+/**
+ * Empty version of VarianceAccumulator, so that a GenericStats without the
+ * variance takes no extra RAM and no floating point operation in update().
+ */
+template <>
+class VarianceAccumulator<false> {
+  protected:
+    void resetVariance() {}
+
+    template <typename T>
+    void updateVariance(T /*value*/) {}
+};
+
+}
+
 /**
  * Helper class to collect timing statistics such as min, max, average, and
- * exponential-decay average. The internal `sum` variable is also a type `T`, so
- * it is important to watch out for overflow of the `sum`. Keeping the number of
- * samples relatively small helps with preventing overflows.
+ * exponential-decay average. By default, the internal `sum` variable is also a
+ * type `T`, so it is important to watch out for overflow of the `sum`. Keeping
+ * the number of samples relatively small, or using a larger `Sum` type, helps
+ * with preventing overflows.
+ *
+ * If `Variance` is true, the variance and standard deviation are calculated
+ * in a single pass using Welford's online algorithm, which keeps a running
+ * mean and the sum of the squared differences from it in a `double` (which is
+ * a 4-byte `float` on AVR). This avoids the catastrophic cancellation of the
+ * naive `sum(x^2) - sum(x)^2/n` formula, but adds 2 `double` fields and a
+ * floating point division to every update(), so it is disabled by default.
+ *
+ * The exponential decay average uses a smoothing factor (alpha) of 1/2^shift,
+ * so that it can be updated using a shift instead of a division for integer
+ * types. The default shift is 1 (alpha = 1/2). A larger shift averages over
+ * roughly the last 2^shift samples.
  *
  * See also `TimingStats` which is the original version of this class,
  * specialized to tracking a `uint16_t` quantity.
  *
  * @tparam T type of the quantity being gathered (e.g. uint32_t or float)
+ * @tparam Sum type of the sum of the quantities (default T)
+ * @tparam C unsigned type of the number of samples (default uint16_t)
+ * @tparam Variance enable getVariance(), getStdDev() and
+ *    getCoefficientOfVariation() (default false)
  */
-template <typename T>
-class GenericStats {
+template <typename T, typename Sum = T, typename C = uint16_t,
+    bool Variance = false>
+class GenericStats: private internal::VarianceAccumulator<Variance> {
   public:
-    /** Constructor. Calls reset(). */
-    GenericStats(): mCounter(0) {
+    /**
+     * Constructor. Calls reset().
+     *
+     * @param expDecayShift the smoothing factor of the exponential decay
+     *    average is 1/2^expDecayShift (default 1, i.e. 1/2), up to 31
+     */
+    explicit GenericStats(uint8_t expDecayShift = 1):
+        mCounter(0),
+        mExpDecayShift(expDecayShift) {
       reset();
     }
 
@@ -67,6 +171,7 @@ class GenericStats {
       mMax = 0;
       mSum = 0;
       mCount = 0;
+      this->resetVariance();
     }
 
     /** Return the maximum since the last reset(). */
@@ -79,23 +184,67 @@ class GenericStats {
      * Return the average since the last reset(). Returns 0 if update()
      * has never been called.
      */
-    T getAvg() const { return (mCount > 0) ? mSum / mCount : 0; }
+    T getAvg() const { return (mCount > 0) ? (T) (mSum / mCount) : 0; }
 
     /** An exponential decay average since the last reset(). */
     T getExpDecayAvg() const { return mExpDecayAvg; }
 
+    /** Return the shift which determines the smoothing factor 1/2^shift. */
+    uint8_t getExpDecayShift() const { return mExpDecayShift; }
+
+    /**
+     * Set the smoothing factor of the exponential decay average to
+     * 1/2^shift. Takes effect on the next update().
+     */
+    void setExpDecayShift(uint8_t shift) { mExpDecayShift = shift; }
+
+    /**
+     * Return the sample variance (dividing by `count - 1`) since the last
+     * reset(), or since getCount() last wrapped around to 0. Returns 0 if
+     * update() was called fewer than 2 times. Requires `Variance` to be true.
+     */
+    double getVariance() const {
+      static_assert(Variance, "getVariance() requires Variance = true");
+      return (this->mVarianceCount > 1)
+          ? this->mM2 / (double) (this->mVarianceCount - 1)
+          : 0;
+    }
+
+    /** Return the sample standard deviation, the square root of the variance. */
+    double getStdDev() const { return sqrt(getVariance()); }
+
+    /**
+     * Return the coefficient of variation, the standard deviation divided by
+     * the absolute value of the mean. This is a measure of the noise that does
+     * not depend on the units, e.g. a value below 0.05 means that the samples
+     * are within about 5% of the mean. Returns 0 if the mean is 0.
+     */
+    double getCoefficientOfVariation() const {
+      static_assert(Variance,
+          "getCoefficientOfVariation() requires Variance = true");
+      double mean = (this->mMean < 0) ? -this->mMean : this->mMean;
+      return (mean > 0) ? getStdDev() / mean : 0;
+    }
+
+    /** Return the sum of the values since the last reset(). */
+    Sum getSum() const { return mSum; }
+
     /** Number of times update() was called since last reset(). */
-    uint16_t getCount() const { return mCount; }
+    C getCount() const { return mCount; }
 
     /**
      * Number of times update() was called from the beginning of time. Never
      * reset. This is useful to determining how many times update() was called
      * since it was last checked from the client code.
      */
-    uint16_t getCounter() const { return mCounter; }
+    C getCounter() const { return mCounter; }
 
     /** Add the given value to the statistics. */
     void update(T value) {
+      // Restart the variance along with the min and max, after reset() or
+      // after mCount wrapped around.
+      if (mCount == 0) this->resetVariance();
+
       mSum += value;
       if (mCount == 0 || value < mMin) {
         mMin = value;
@@ -107,20 +256,23 @@ class GenericStats {
       if (mCount == 0) {
         mExpDecayAvg = value;
       } else {
-        mExpDecayAvg = (mExpDecayAvg/2) + (value/2);
+        mExpDecayAvg = internal::updateExpDecayAvg(
+            mExpDecayAvg, value, mExpDecayShift);
       }
 
       mCount++;
       mCounter++;
+      this->updateVariance(value);
     }
 
   private:
     T mExpDecayAvg;
     T mMin;
     T mMax;
-    T mSum;
-    uint16_t mCount;
-    uint16_t mCounter;
+    Sum mSum;
+    C mCount;
+    C mCounter;
+    uint8_t mExpDecayShift;
 };
 
 }
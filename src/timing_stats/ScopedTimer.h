@@ -0,0 +1,114 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_SCOPED_TIMER_H
+#define ACE_COMMON_SCOPED_TIMER_H
+
+#include <stdint.h>
+#include "TimingStats.h"
+#include "CycleClock.h"
+
+namespace ace_common {
+
+namespace internal {
+
+/** Add the `elapsed` ticks to a generic `Stats` object. */
+template <typename Stats>
+void updateElapsed(Stats& stats, uint32_t elapsed) {
+  stats.update(elapsed);
+}
+
+/**
+ * Add the `elapsed` ticks to a TimingStatsT, saturated to the maximum of its
+ * duration type S, so that a long scope is recorded as the largest duration
+ * instead of being truncated modulo 2^16 for a `uint16_t`.
+ */
+template <typename S, typename Sum, typename C>
+void updateElapsed(TimingStatsT<S, Sum, C>& stats, uint32_t elapsed) {
+  const S maxDuration = (S) -1;
+  stats.update((elapsed > maxDuration) ? maxDuration : (S) elapsed);
+}
+
+}
+
+/**
+ * Measure the duration of a scope in ticks of the `Clock` (microseconds by
+ * default), and add it to the `Stats` object (e.g. `TimingStatsT`) when the
+ * scope exits. This replaces the pattern of calling `micros()` before and
+ * after a block of code, then calling `stats.update()` with the difference:
+ *
+ * @code
+ * TimingStatsT<uint32_t, uint64_t> stats;
+ *
+ * void readSensor() {
+ *   ScopedTimerT<TimingStatsT<uint32_t, uint64_t>> timer(stats);
+ *   ...
+ * }
+ * @endcode
+ *
+ * Use `CycleClock` as the `Clock` to time short functions in CPU cycles
+ * instead. The ticks can be converted using `Clock::toNanos()`.
+ *
+ * @tparam Stats class with an `update(duration)` method, e.g. `TimingStats`,
+ *    `TimingStatsT`, `TimingHistogram` or `WindowedStats`
+ * @tparam Clock clock source, `MicrosClock` or `CycleClock`
+ */
+template <typename Stats, typename Clock = MicrosClock>
+class ScopedTimerT {
+  public:
+    /** Constructor. Start the timer. */
+    explicit ScopedTimerT(Stats& stats):
+        mStats(stats),
+        mStart(Clock::now())
+    {}
+
+    /** Destructor. Add the elapsed ticks to the stats. */
+    ~ScopedTimerT() {
+      internal::updateElapsed(mStats, getElapsed());
+    }
+
+    /** Return the number of ticks since the timer was started. */
+    uint32_t getElapsed() const {
+      return Clock::now() - mStart;
+    }
+
+  private:
+    // disable copy-constructor and assignment operator
+    ScopedTimerT(const ScopedTimerT&) = delete;
+    ScopedTimerT& operator=(const ScopedTimerT&) = delete;
+
+    Stats& mStats;
+    uint32_t const mStart;
+};
+
+/**
+ * A ScopedTimerT which updates a `TimingStats` in microseconds. The duration
+ * saturates at 65535, so this is suitable for scopes shorter than 65
+ * milliseconds.
+ */
+typedef ScopedTimerT<TimingStats> ScopedTimer;
+
+}
+
+#endif
@@ -0,0 +1,241 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_TIMING_HISTOGRAM_H
+#define ACE_COMMON_TIMING_HISTOGRAM_H
+
+#include <stdint.h>
+#include <string.h> // memset()
+#include <Print.h>
+
+namespace ace_common {
+
+namespace internal {
+
+/** Return floor(log2(value)) for a non-zero value. */
+inline uint8_t log2Floor(uint32_t value) {
+#if defined(__GNUC__)
+  return (sizeof(unsigned int) >= sizeof(uint32_t))
+      ? 31 - __builtin_clz((unsigned int) value)
+      : 31 - __builtin_clzl((unsigned long) value);
+#else
+  uint8_t n = 0;
+  while (value >>= 1) n++;
+  return n;
+#endif
+}
+
+}
+
+/**
+ * A histogram of durations (or any other unsigned quantity) using log-linear
+ * buckets, similar to the HdrHistogram (https://hdrhistogram.github.io/). The
+ * values below 2^SubBucketBits have one bucket each. Each power of 2 above
+ * that is divided into 2^SubBucketBits linear buckets, so each bucket covers
+ * at most 1/2^SubBucketBits of the values in it (e.g. 6.25% for 4 bits). This
+ * allows the percentiles (e.g. p50, p95, p99) of the tail latency to be
+ * calculated using a fixed amount of memory, with a bounded relative error.
+ *
+ * The update() method runs in constant time. The min, max and average are
+ * exact.
+ * Values of 2^MaxBits or larger are counted in the last bucket, whose
+ * percentiles are reported as the exact max.
+ *
+ * The number of buckets is `(MaxBits - SubBucketBits + 1) * 2^SubBucketBits`.
+ * For example, `TimingHistogram<4, 20>` holds durations up to about 1 second
+ * in microseconds using 272 buckets, which consumes 544 bytes of RAM with
+ * the default `uint16_t` counters. The counters saturate at their maximum
+ * value (65535 for `uint16_t`) instead of wrapping around. Use `uint32_t`
+ * counters if a single bucket may receive more updates than that.
+ *
+ * @tparam SubBucketBits number of bits of precision of each bucket
+ * @tparam MaxBits number of bits of the largest value, up to 32
+ * @tparam C unsigned type of the counter of each bucket (default uint16_t)
+ */
+template <uint8_t SubBucketBits, uint8_t MaxBits, typename C = uint16_t>
+class TimingHistogram {
+  static_assert(SubBucketBits < MaxBits, "SubBucketBits must be < MaxBits");
+  static_assert(MaxBits <= 32, "MaxBits must be <= 32");
+  static_assert((C) -1 > 0, "C must be an unsigned type");
+
+  public:
+    /** Number of sub-buckets in each power of 2. */
+    static const uint16_t kSubBuckets = (uint16_t) 1 << SubBucketBits;
+
+    /** Total number of buckets. */
+    static const uint16_t kNumBuckets =
+        (MaxBits - SubBucketBits + 1) * kSubBuckets;
+
+    /** Maximum count of a bucket, where it saturates. */
+    static const C kMaxBucketCount = (C) -1;
+
+    /** Constructor. Calls reset(). */
+    TimingHistogram() {
+      reset();
+    }
+
+    /** Reset the object to its initial state. */
+    void reset() {
+      memset(mBuckets, 0, sizeof(mBuckets));
+      mMin = 0;
+      mMax = 0;
+      mSum = 0;
+      mCount = 0;
+    }
+
+    /** Return the minimum since the last reset(). */
+    uint32_t getMin() const { return mMin; }
+
+    /** Return the maximum since the last reset(). */
+    uint32_t getMax() const { return mMax; }
+
+    /**
+     * Return the average since the last reset(). Returns 0 if update() has
+     * never been called.
+     */
+    uint32_t getAvg() const {
+      return (mCount > 0) ? (uint32_t) (mSum / mCount) : 0;
+    }
+
+    /** Number of times update() was called since last reset(). */
+    uint32_t getCount() const { return mCount; }
+
+    /** Return the count of the bucket at `index`. */
+    C getBucketCount(uint16_t index) const { return mBuckets[index]; }
+
+    /** Add the given value to the histogram. */
+    void update(uint32_t value) {
+      if (mCount == 0 || value < mMin) mMin = value;
+      if (mCount == 0 || value > mMax) mMax = value;
+      C& bucket = mBuckets[bucketIndex(value)];
+      if (bucket < kMaxBucketCount) bucket++;
+      mSum += value;
+      mCount++;
+    }
+
+    /**
+     * Return the value at or below which `percent` percent of the values
+     * fall, for example `getPercentile(99)` for p99. The result is the largest
+     * value of the bucket which contains it, clamped to the exact min and max.
+     * The last bucket also holds the values of 2^MaxBits or larger, so its
+     * percentiles are the exact max. Returns 0 if update() has never been
+     * called.
+     */
+    uint32_t getPercentile(uint8_t percent) const {
+      if (mCount == 0) return 0;
+      if (percent >= 100) return mMax;
+
+      // Rank of the value, from 1 to mCount, rounded up.
+      uint32_t rank = (uint32_t) (((uint64_t) mCount * percent + 99) / 100);
+      if (rank == 0) return mMin;
+
+      uint32_t cumulative = 0;
+      for (uint16_t i = 0; i < kNumBuckets; i++) {
+        cumulative += mBuckets[i];
+        if (cumulative >= rank) {
+          if (i == kNumBuckets - 1) return mMax;
+          uint32_t value = bucketUpperBound(i);
+          if (value < mMin) return mMin;
+          if (value > mMax) return mMax;
+          return value;
+        }
+      }
+      return mMax;
+    }
+
+    /**
+     * Add the counts of the `other` histogram into this one, for example to
+     * combine the histograms collected by different tasks or intervals.
+     */
+    void merge(const TimingHistogram& other) {
+      if (other.mCount == 0) return;
+      if (mCount == 0 || other.mMin < mMin) mMin = other.mMin;
+      if (mCount == 0 || other.mMax > mMax) mMax = other.mMax;
+      for (uint16_t i = 0; i < kNumBuckets; i++) {
+        C room = kMaxBucketCount - mBuckets[i];
+        mBuckets[i] = (other.mBuckets[i] > room)
+            ? kMaxBucketCount
+            : (C) (mBuckets[i] + other.mBuckets[i]);
+      }
+      mSum += other.mSum;
+      mCount += other.mCount;
+    }
+
+    /**
+     * Print a one-line summary, for example
+     * "count=100 min=10 avg=21 p50=20 p95=37 p99=39 max=40".
+     */
+    void printTo(Print& printer) const {
+      printer.print(F("count="));
+      printer.print(mCount);
+      printer.print(F(" min="));
+      printer.print(mMin);
+      printer.print(F(" avg="));
+      printer.print(getAvg());
+      printer.print(F(" p50="));
+      printer.print(getPercentile(50));
+      printer.print(F(" p95="));
+      printer.print(getPercentile(95));
+      printer.print(F(" p99="));
+      printer.print(getPercentile(99));
+      printer.print(F(" max="));
+      printer.print(mMax);
+    }
+
+    /** Return the index of the bucket which holds the `value`. */
+    static uint16_t bucketIndex(uint32_t value) {
+      if (value < kSubBuckets) return (uint16_t) value;
+      uint8_t magnitude = internal::log2Floor(value);
+      if (magnitude >= MaxBits) return kNumBuckets - 1;
+      uint8_t shift = magnitude - SubBucketBits;
+      uint16_t subBucket = (uint16_t) (value >> shift) - kSubBuckets;
+      return (uint16_t) ((shift + 1) * kSubBuckets + subBucket);
+    }
+
+    /** Return the largest value which is counted in the bucket at `index`. */
+    static uint32_t bucketUpperBound(uint16_t index) {
+      uint8_t group = index >> SubBucketBits;
+      uint16_t subBucket = index & (kSubBuckets - 1);
+      if (group == 0) return subBucket;
+      uint8_t shift = group - 1;
+      uint32_t lower = (uint32_t) (kSubBuckets + subBucket) << shift;
+      return lower + (((uint32_t) 1 << shift) - 1);
+    }
+
+  private:
+    // Disable copy-constructor and assignment operator, because copying the
+    // buckets by accident is expensive.
+    TimingHistogram(const TimingHistogram&) = delete;
+    TimingHistogram& operator=(const TimingHistogram&) = delete;
+
+    C mBuckets[kNumBuckets];
+    uint32_t mMin;
+    uint32_t mMax;
+    uint64_t mSum;
+    uint32_t mCount;
+};
+
+}
+
+#endif
@@ -0,0 +1,177 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_TIMING_PROBES_H
+#define ACE_COMMON_TIMING_PROBES_H
+
+#include <stdint.h>
+#include <Arduino.h> // __FlashStringHelper, strlen_P()
+#include "../pstrings/pstrings.h" // strcmp_PP()
+#include "../print_utils/printPadTo.h"
+#include "TimingStats.h"
+
+namespace ace_common {
+
+/**
+ * A fixed-capacity registry of named timing probes, each holding a `Stats`
+ * object (e.g. `TimingStats`), which can all be printed in a single table.
+ * The names are stored in flash memory using the `F()` macro. No dynamic
+ * memory is allocated, so a single global instance can collect the timing of
+ * the hot paths of an entire firmware:
+ *
+ * @code
+ * TimingProbes<8> probes;
+ *
+ * void readSensor() {
+ *   ScopedTimer timer(probes.probe(F("readSensor")));
+ *   ...
+ * }
+ *
+ * void printProbes() {
+ *   probes.printTo(Serial);
+ * }
+ * @endcode
+ *
+ * @tparam Capacity maximum number of probes, up to 255
+ * @tparam Stats class of the statistics of each probe, with integer
+ *    `getCount()`, `getMin()`, `getAvg()` and `getMax()` methods (default
+ *    `TimingStats`)
+ */
+template <uint8_t Capacity, typename Stats = TimingStats>
+class TimingProbes {
+  public:
+    /** Constructor. */
+    TimingProbes() = default;
+
+    /**
+     * Return the stats of the probe with the given name, registering it if
+     * necessary. The probes are searched linearly, comparing the pointers
+     * first, so a probe called from a single place is found without comparing
+     * the strings. Hot paths can also keep the returned reference, which
+     * remains valid for the lifetime of the registry. If the registry is full,
+     * the stats of an unnamed overflow probe are returned, which is never
+     * printed.
+     */
+    Stats& probe(const __FlashStringHelper* name) {
+      for (uint8_t i = 0; i < mSize; i++) {
+        if (mProbes[i].name == name) return mProbes[i].stats;
+      }
+      for (uint8_t i = 0; i < mSize; i++) {
+        if (strcmp_PP((const char*) mProbes[i].name, (const char*) name) == 0) {
+          return mProbes[i].stats;
+        }
+      }
+      if (mSize >= Capacity) {
+        mIsOverflow = true;
+        return mOverflow;
+      }
+
+      Probe& probe = mProbes[mSize++];
+      probe.name = name;
+      return probe.stats;
+    }
+
+    /** Return the number of registered probes. */
+    uint8_t size() const { return mSize; }
+
+    /** Return true if probe() was called after the registry became full. */
+    bool isOverflow() const { return mIsOverflow; }
+
+    /** Return the name of the probe at index i. */
+    const __FlashStringHelper* getName(uint8_t i) const {
+      return mProbes[i].name;
+    }
+
+    /** Return the stats of the probe at index i. */
+    const Stats& getStats(uint8_t i) const { return mProbes[i].stats; }
+
+    /** Reset the stats of all probes, keeping the probes registered. */
+    void reset() {
+      for (uint8_t i = 0; i < mSize; i++) {
+        mProbes[i].stats.reset();
+      }
+      mOverflow.reset();
+    }
+
+    /**
+     * Print the stats of all probes as a table, with one header line, then
+     * one line per probe in the order of registration:
+     *
+     * @verbatim
+     * name       count    min    avg    max
+     * readSensor    12    352    360    401
+     * update         3     20     25     33
+     * @endverbatim
+     */
+    void printTo(Print& printer) const {
+      uint8_t nameWidth = 4; // strlen("name")
+      for (uint8_t i = 0; i < mSize; i++) {
+        size_t len = strlen_P((const char*) mProbes[i].name);
+        if (len > nameWidth) nameWidth = (len > 255) ? 255 : len;
+      }
+
+      printer.print(F("name"));
+      printSpaces(printer, nameWidth - 4);
+      printer.println(F("  count    min    avg    max"));
+      for (uint8_t i = 0; i < mSize; i++) {
+        const Probe& probe = mProbes[i];
+        printer.print(probe.name);
+        // The width is capped at 255, so a longer name gets no padding.
+        size_t len = strlen_P((const char*) probe.name);
+        printSpaces(printer, (len < nameWidth) ? nameWidth - len : 0);
+        printer.write(' ');
+        printPadTo<6>(printer, probe.stats.getCount());
+        printer.write(' ');
+        printPadTo<6>(printer, probe.stats.getMin());
+        printer.write(' ');
+        printPadTo<6>(printer, probe.stats.getAvg());
+        printer.write(' ');
+        printPadTo<6>(printer, probe.stats.getMax());
+        printer.println();
+      }
+    }
+
+  private:
+    struct Probe {
+      const __FlashStringHelper* name;
+      Stats stats;
+    };
+
+    static void printSpaces(Print& printer, size_t n) {
+      for (; n > 0; n--) printer.write(' ');
+    }
+
+    // disable copy-constructor and assignment operator
+    TimingProbes(const TimingProbes&) = delete;
+    TimingProbes& operator=(const TimingProbes&) = delete;
+
+    Probe mProbes[Capacity];
+    Stats mOverflow;
+    uint8_t mSize = 0;
+    bool mIsOverflow = false;
+};
+
+}
+
+#endif
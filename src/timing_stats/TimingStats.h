@@ -31,12 +31,22 @@ namespace ace_common {
 
 /**
  * Helper class to collect timing statistics such as min, max, average, and
- * exponential-decay average.
+ * exponential-decay average, for an unsigned duration type `S`. The sum of
+ * the durations is accumulated in the type `Sum`, and the number of samples in
+ * the type `C`, so that they can be made large enough to avoid overflow. For
+ * example, `TimingStatsT<uint32_t, uint64_t>` collects durations in
+ * microseconds over a long benchmark run exactly.
+ *
+ * @tparam S unsigned type of the duration (e.g. uint16_t, uint32_t)
+ * @tparam Sum unsigned type of the sum of the durations, at least as large as
+ *    S (e.g. uint32_t, uint64_t)
+ * @tparam C unsigned type of the number of samples (default uint32_t)
  */
-class TimingStats {
+template <typename S, typename Sum, typename C = uint32_t>
+class TimingStatsT {
   public:
     /** Constructor. Calls reset(). */
-    TimingStats(): mCounter(0) {
+    TimingStatsT(): mCounter(0) {
       reset();
     }
 
@@ -44,10 +54,10 @@ class TimingStats {
     // to keep it quiet.
 
     /** Default copy constructor. */
-    TimingStats(const TimingStats&) = default;
+    TimingStatsT(const TimingStatsT&) = default;
 
     /** Default assignment operator. */
-    TimingStats& operator=(const TimingStats&) = default;
+    TimingStatsT& operator=(const TimingStatsT&) = default;
 
     /**
      * Reset the object to its initial state, except mCounter which is
@@ -55,39 +65,42 @@ class TimingStats {
      */
     void reset() {
       mExpDecayAvg = 0;
-      mMin = UINT16_MAX;
+      mMin = (S) -1;
       mMax = 0;
       mSum = 0;
       mCount = 0;
     }
 
     /** Return the maximum since the last reset(). */
-    uint16_t getMax() const { return mMax; }
+    S getMax() const { return mMax; }
 
     /** Return the minium since the last reset(). */
-    uint16_t getMin() const { return mMin; }
+    S getMin() const { return mMin; }
 
     /**
      * Return the average since the last reset(). Returns 0 if update()
      * has never been called.
      */
-    uint16_t getAvg() const { return (mCount > 0) ? mSum / mCount : 0; }
+    S getAvg() const { return (mCount > 0) ? (S) (mSum / mCount) : 0; }
 
     /** An exponential decay average since the last reset(). */
-    uint16_t getExpDecayAvg() const { return mExpDecayAvg; }
+    S getExpDecayAvg() const { return mExpDecayAvg; }
+
+    /** Return the sum of the durations since the last reset(). */
+    Sum getSum() const { return mSum; }
 
     /** Number of times update() was called since last reset(). */
-    uint16_t getCount() const { return mCount; }
+    C getCount() const { return mCount; }
 
     /**
      * Number of times update() was called from the beginning of time. Never
      * reset. This is useful to determining how many times update() was called
      * since it was last checked from the client code.
      */
-    uint16_t getCounter() const { return mCounter; }
+    C getCounter() const { return mCounter; }
 
     /** Add the given duration (often in milliseconds) to the statistics. */
-    void update(uint16_t duration) {
+    void update(S duration) {
       mSum += duration;
       if (duration < mMin) {
         mMin = duration;
@@ -99,8 +112,8 @@ class TimingStats {
       if (mCount == 0) {
         mExpDecayAvg = duration;
       } else {
-        // Use a slightly convoluted averaging algorithm to prevent uint16_t
-        // overflow and to preserve accuracy in the least significant bit.
+        // Use a slightly convoluted averaging algorithm to prevent overflow of
+        // S and to preserve accuracy in the least significant bit.
         mExpDecayAvg = (mExpDecayAvg/2) + (duration/2)
           + ((mExpDecayAvg & 0x1) & (duration & 0x1));
       }
@@ -109,15 +122,46 @@ class TimingStats {
       mCounter++;
     }
 
+    /**
+     * Add the statistics collected by `other` into this object, for example
+     * to combine the statistics collected by different tasks or cores. The
+     * exponential decay average becomes the average of the 2 exponential
+     * decay averages.
+     */
+    void merge(const TimingStatsT& other) {
+      if (other.mCount != 0) {
+        if (other.mMin < mMin) mMin = other.mMin;
+        if (other.mMax > mMax) mMax = other.mMax;
+        if (mCount == 0) {
+          mExpDecayAvg = other.mExpDecayAvg;
+        } else {
+          mExpDecayAvg = (mExpDecayAvg/2) + (other.mExpDecayAvg/2)
+            + ((mExpDecayAvg & 0x1) & (other.mExpDecayAvg & 0x1));
+        }
+        mSum += other.mSum;
+        mCount += other.mCount;
+      }
+      mCounter += other.mCounter;
+    }
+
   private:
-    uint16_t mExpDecayAvg;
-    uint16_t mMin;
-    uint16_t mMax;
-    uint32_t mSum;
-    uint16_t mCount;
-    uint16_t mCounter;
+    S mExpDecayAvg;
+    S mMin;
+    S mMax;
+    Sum mSum;
+    C mCount;
+    C mCounter;
 };
 
+/**
+ * The original timing statistics class, which collects `uint16_t` durations,
+ * with a `uint32_t` sum and a `uint16_t` count. Durations longer than 65535
+ * (e.g. 65 milliseconds in micros) wrap around, and the average becomes
+ * incorrect after 65535 samples. Use `TimingStatsT<uint32_t, uint64_t>` for
+ * longer durations or more samples.
+ */
+typedef TimingStatsT<uint16_t, uint32_t, uint16_t> TimingStats;
+
 }
 
 #endif
@@ -0,0 +1,228 @@
+/*
+MIT License
+
+Copyright (c) 2026 Brian T. Park
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ACE_COMMON_WINDOWED_STATS_H
+#define ACE_COMMON_WINDOWED_STATS_H
+
+#include <stdint.h>
+#include "../arithmetic/arithmetic.h" // incrementMod()
+#include "GenericStats.h"
+
+namespace ace_common {
+
+/**
+ * Statistics over a sliding window of the last `Buckets` intervals (e.g. the
+ * last 60 seconds), instead of everything since the last reset(). The values
+ * of each interval are collected in a ring of `GenericStats` buckets. At the
+ * end of each interval, advance() (or tick()) moves to the next bucket,
+ * dropping the oldest one, so old values disappear without resetting
+ * everything.
+ *
+ * The count, sum and average of the window are maintained incrementally.
+ * The min and max of the window are maintained using 2 monotonic deques of
+ * bucket indexes: the buckets in the max deque have strictly decreasing
+ * maximums from the oldest to the newest, so the front of the deque is the
+ * maximum of the window, and a bucket is removed from the back as soon as a
+ * newer bucket has a larger or equal maximum. All operations take O(1)
+ * amortized time.
+ *
+ * @tparam T type of the quantity being gathered (e.g. uint32_t or float)
+ * @tparam Buckets number of intervals in the window, up to 255
+ * @tparam Sum type of the sum of the quantities (default T)
+ * @tparam C unsigned type of the number of samples in each bucket (default
+ *    uint16_t)
+ */
+template <
+    typename T,
+    uint8_t Buckets,
+    typename Sum = T,
+    typename C = uint16_t>
+class WindowedStats {
+  static_assert(Buckets > 0, "Buckets must be > 0");
+
+  public:
+    /** The type of the statistics of a single interval. */
+    typedef GenericStats<T, Sum, C> Bucket;
+
+    /**
+     * Constructor.
+     *
+     * @param interval the duration of each bucket used by tick(), in the same
+     *    units as its `now` parameter (e.g. 1000 millis). Not used by
+     *    advance().
+     */
+    explicit WindowedStats(uint32_t interval = 1000):
+        mInterval(interval) {
+      reset();
+    }
+
+    /** Clear all buckets. */
+    void reset() {
+      for (uint8_t i = 0; i < Buckets; i++) {
+        mBuckets[i].reset();
+      }
+      mIndex = 0;
+      mSum = 0;
+      mCount = 0;
+      mMaxHead = 0;
+      mMaxSize = 0;
+      mMinHead = 0;
+      mMinSize = 0;
+      mIntervalStart = 0;
+      mStarted = false;
+    }
+
+    /** Add the given value to the current interval. */
+    void update(T value) {
+      Bucket& bucket = mBuckets[mIndex];
+      bool isFirst = bucket.getCount() == 0;
+      bool isNewMax = isFirst || value > bucket.getMax();
+      bool isNewMin = isFirst || value < bucket.getMin();
+      bucket.update(value);
+      mSum += value;
+      mCount++;
+
+      if (isNewMax) {
+        // Remove the current bucket and the older buckets whose max is not
+        // larger, then append the current bucket.
+        while (mMaxSize > 0 && ! (mBuckets[maxBack()].getMax() > value)) {
+          mMaxSize--;
+        }
+        mMaxDeque[(uint8_t) ((mMaxHead + mMaxSize) % Buckets)] = mIndex;
+        mMaxSize++;
+      }
+      if (isNewMin) {
+        while (mMinSize > 0 && ! (mBuckets[minBack()].getMin() < value)) {
+          mMinSize--;
+        }
+        mMinDeque[(uint8_t) ((mMinHead + mMinSize) % Buckets)] = mIndex;
+        mMinSize++;
+      }
+    }
+
+    /**
+     * Move to the next interval, dropping the values of the oldest interval
+     * from the window.
+     */
+    void advance() {
+      incrementMod(mIndex, Buckets);
+
+      Bucket& oldest = mBuckets[mIndex];
+      mSum -= oldest.getSum();
+      mCount -= oldest.getCount();
+      oldest.reset();
+
+      // The oldest bucket can only be at the front of the deques.
+      if (mMaxSize > 0 && mMaxDeque[mMaxHead] == mIndex) {
+        incrementMod(mMaxHead, Buckets);
+        mMaxSize--;
+      }
+      if (mMinSize > 0 && mMinDeque[mMinHead] == mIndex) {
+        incrementMod(mMinHead, Buckets);
+        mMinSize--;
+      }
+    }
+
+    /**
+     * Call advance() once for each full interval which has elapsed since the
+     * start of the current interval. Call this with the current time (e.g.
+     * `millis()`) before update(), or periodically from the loop(). The first
+     * call starts the first interval.
+     */
+    void tick(uint32_t now) {
+      if (! mStarted) {
+        mStarted = true;
+        mIntervalStart = now;
+        return;
+      }
+
+      uint32_t elapsed = now - mIntervalStart;
+      if (elapsed < mInterval) return;
+      uint32_t intervals = elapsed / mInterval;
+      mIntervalStart += intervals * mInterval;
+
+      // Advancing more than the whole window clears every bucket.
+      if (intervals > Buckets) intervals = Buckets;
+      for (uint32_t i = 0; i < intervals; i++) {
+        advance();
+      }
+    }
+
+    /** Return the maximum of the window, or 0 if it is empty. */
+    T getMax() const {
+      return (mMaxSize > 0) ? mBuckets[mMaxDeque[mMaxHead]].getMax() : 0;
+    }
+
+    /** Return the minimum of the window, or 0 if it is empty. */
+    T getMin() const {
+      return (mMinSize > 0) ? mBuckets[mMinDeque[mMinHead]].getMin() : 0;
+    }
+
+    /** Return the average of the window, or 0 if it is empty. */
+    T getAvg() const { return (mCount > 0) ? (T) (mSum / mCount) : 0; }
+
+    /** Return the sum of the values in the window. */
+    Sum getSum() const { return mSum; }
+
+    /** Return the number of values in the window. */
+    uint32_t getCount() const { return mCount; }
+
+    /** Return the statistics of the current interval. */
+    const Bucket& getCurrent() const { return mBuckets[mIndex]; }
+
+    /**
+     * Return the statistics of the interval `age` intervals ago, where 0 is
+     * the current interval and `Buckets - 1` is the oldest.
+     */
+    const Bucket& getBucket(uint8_t age) const {
+      return mBuckets[(uint8_t) ((mIndex + Buckets - age) % Buckets)];
+    }
+
+  private:
+    uint8_t maxBack() const {
+      return mMaxDeque[(uint8_t) ((mMaxHead + mMaxSize - 1) % Buckets)];
+    }
+
+    uint8_t minBack() const {
+      return mMinDeque[(uint8_t) ((mMinHead + mMinSize - 1) % Buckets)];
+    }
+
+    Bucket mBuckets[Buckets];
+    uint8_t mMaxDeque[Buckets];
+    uint8_t mMinDeque[Buckets];
+    Sum mSum;
+    uint32_t mCount;
+    uint32_t mInterval;
+    uint32_t mIntervalStart;
+    uint8_t mIndex;
+    uint8_t mMaxHead;
+    uint8_t mMaxSize;
+    uint8_t mMinHead;
+    uint8_t mMinSize;
+    bool mStarted;
+};
+
+}
+
+#endif
@@ -33,6 +33,10 @@ SOFTWARE.
  * The compiler will select the correct implementation automatically at
  * compile-time.
  *
+ * If ACE_COMMON_UNIFIED_FLASH is 1, the f-string is a normal pointer and the
+ * overloads for `const __FlashStringHelper*` call the `<string.h>` functions
+ * directly.
+ *
  * Ideally all functions included in `<pgmspace.h>` that end in the `_P` suffix
  * would be included here. But I don't have infinite time, so this currently
  * includes only the most popular ones, or the ones that are needed for my own
@@ -44,6 +48,7 @@ SOFTWARE.
 
 #include <string.h>
 #include <Arduino.h> // xxx_P()
+#include "../fstrings/FlashString.h" // ACE_COMMON_UNIFIED_FLASH
 
 class __FlashStringHelper;
 
@@ -55,64 +60,100 @@ inline char* strcat_T(char* dest, const char* src) {
   return strcat(dest, src);
 }
 inline char* strcat_T(char* dest, const __FlashStringHelper* src) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strcat(dest, (const char*) src);
+#else
   return strcat_P(dest, (const char*) src);
+#endif
 }
 
 inline const char* strchr_T(const char* s, int c) {
   return strchr(s, c);
 }
 inline const char* strchr_T(const __FlashStringHelper* s, int c) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strchr((const char*) s, c);
+#else
   return strchr_P((const char*) s, c);
+#endif
 }
 
 inline int strcmp_T(const char* s1, const char* s2) {
   return strcmp(s1, s2);
 }
 inline int strcmp_T(const char* s1, const __FlashStringHelper* s2) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strcmp(s1, (const char*) s2);
+#else
   return strcmp_P(s1, (const char*) s2);
+#endif
 }
 
 inline char* strcpy_T(char* dest, const char* src) {
   return strcpy(dest, src);
 }
 inline char* strcpy_T(char* dest, const __FlashStringHelper* src) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strcpy(dest, (const char*) src);
+#else
   return strcpy_P(dest, (const char*) src);
+#endif
 }
 
 inline size_t strlen_T(const char* s) {
   return strlen(s);
 }
 inline size_t strlen_T(const __FlashStringHelper* s) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strlen((const char*) s);
+#else
   return strlen_P((const char*) s);
+#endif
 }
 
 inline char* strncat_T(char* dest, const char* src, size_t n) {
   return strncat(dest, src, n);
 }
 inline char* strncat_T(char* dest, const __FlashStringHelper* src, size_t n) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strncat(dest, (const char*) src, n);
+#else
   return strncat_P(dest, (const char*) src, n);
+#endif
 }
 
 inline int strncmp_T(const char* s1, const char* s2, size_t n) {
   return strncmp(s1, s2, n);
 }
 inline int strncmp_T(const char* s1, const __FlashStringHelper* s2, size_t n) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strncmp(s1, (const char*) s2, n);
+#else
   return strncmp_P(s1, (const char*) s2, n);
+#endif
 }
 
 inline char* strncpy_T(char* dest, const char* src, size_t n) {
   return strncpy(dest, src, n);
 }
 inline char* strncpy_T(char* dest, const __FlashStringHelper* src, size_t n) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strncpy(dest, (const char*) src, n);
+#else
   return strncpy_P(dest, (const char*) src, n);
+#endif
 }
 
 inline const char* strrchr_T(const char* s, int c) {
   return strrchr(s, c);
 }
 inline const char* strrchr_T(const __FlashStringHelper* s, int c) {
+#if ACE_COMMON_UNIFIED_FLASH
+  return strrchr((const char*) s, c);
+#else
   // ESP8266 and ESP32 don't provide strrch_P(), but AceCommon/pstrings.h does.
   return strrchr_P((const char*) s, c);
+#endif
 }
 
 }
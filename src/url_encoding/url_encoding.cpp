@@ -81,6 +81,10 @@ void byteToHexChar(uint8_t c, char* high, char* low, char baseChar) {
 }
 
 uint8_t hexCharToByte(char c) {
+#if ACE_COMMON_HEX_CHAR_TABLE
+  uint8_t value = internal::hexValue(c);
+  return (value & 0xF0) ? 0 : value;
+#else
   if (c >= '0' && c <= '9') {
     return c - '0';
   }
@@ -94,6 +98,7 @@ uint8_t hexCharToByte(char c) {
     return c - 'a' + 10;
   }
   return 0;
+#endif
 }
 
 }
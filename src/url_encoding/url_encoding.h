@@ -34,6 +34,19 @@ SOFTWARE.
 #define ACE_COMMON_URL_ENCODING_H
 
 #include <stdint.h> // uint8_t
+#include "../optimize/optimize.h"
+#include "../hex_encoding/hex_encoding.h" // internal::hexValue()
+
+// Decode the hex characters of hexCharToByte() and backslashXDecode() using
+// internal::hexValue() instead of a chain of comparisons, when optimizing for
+// speed.
+#ifndef ACE_COMMON_HEX_CHAR_TABLE
+  #if defined(ACE_COMMON_OPTIMIZE_SPEED)
+    #define ACE_COMMON_HEX_CHAR_TABLE 1
+  #else
+    #define ACE_COMMON_HEX_CHAR_TABLE 0
+  #endif
+#endif
 
 class Print;
 
@@ -0,0 +1,263 @@
+#line 2 "Base64EncodingTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+//----------------------------------------------------------------------------
+// Test base64Encode() using the test vectors from RFC 4648, section 10.
+//----------------------------------------------------------------------------
+
+static const uint8_t* bytes(const char* s) { return (const uint8_t*) s; }
+
+test(base64Encode, rfc4648) {
+  char t[16];
+  size_t written;
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes(""), 0, &written));
+  assertEqual((size_t) 0, written);
+  assertEqual("", t);
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes("f"), 1, &written));
+  assertEqual((size_t) 4, written);
+  assertEqual("Zg==", t);
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes("fo"), 2, &written));
+  assertEqual("Zm8=", t);
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes("foo"), 3, &written));
+  assertEqual("Zm9v", t);
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes("foob"), 4, &written));
+  assertEqual("Zm9vYg==", t);
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes("fooba"), 5, &written));
+  assertEqual("Zm9vYmE=", t);
+
+  assertEqual(0, base64Encode(t, sizeof(t), bytes("foobar"), 6, &written));
+  assertEqual((size_t) 8, written);
+  assertEqual("Zm9vYmFy", t);
+}
+
+test(base64Encode, tooLong) {
+  // Room for only 1 complete group and the NUL terminator.
+  char t[8];
+  size_t written;
+  uint8_t status = base64Encode(t, sizeof(t), bytes("foobar"), 6, &written);
+  assertEqual(status, 1);
+  assertEqual((size_t) 4, written);
+  assertEqual("Zm9v", t);
+}
+
+test(base64Encode, zeroCapacity) {
+  // Nothing, not even the NUL terminator, is written into a 0-sized buffer.
+  char t[4] = "xyz";
+  size_t written = 99;
+  uint8_t status = base64Encode(t, 0, bytes("foobar"), 6, &written);
+  assertEqual(status, 1);
+  assertEqual((size_t) 0, written);
+  assertEqual("xyz", t);
+
+  status = base64UrlEncode(t, 0, bytes("f"), 1, &written);
+  assertEqual(status, 1);
+  assertEqual((size_t) 0, written);
+  assertEqual("xyz", t);
+
+  assertEqual(0, base64Encode(t, 0, bytes(""), 0, &written));
+  assertEqual("xyz", t);
+}
+
+//----------------------------------------------------------------------------
+// Test base64Decode()
+//----------------------------------------------------------------------------
+
+test(base64Decode, normal) {
+  uint8_t t[16];
+  size_t written;
+
+  assertEqual(0, base64Decode(t, sizeof(t), "", &written));
+  assertEqual((size_t) 0, written);
+
+  assertEqual(0, base64Decode(t, sizeof(t), "Zg==", &written));
+  assertEqual((size_t) 1, written);
+  assertEqual(0, memcmp(t, "f", 1));
+
+  assertEqual(0, base64Decode(t, sizeof(t), "Zm8=", &written));
+  assertEqual((size_t) 2, written);
+  assertEqual(0, memcmp(t, "fo", 2));
+
+  assertEqual(0, base64Decode(t, sizeof(t), "Zm9vYmFy", &written));
+  assertEqual((size_t) 6, written);
+  assertEqual(0, memcmp(t, "foobar", 6));
+}
+
+test(base64Decode, noPadding) {
+  uint8_t t[16];
+  size_t written;
+
+  assertEqual(0, base64Decode(t, sizeof(t), "Zm9vYg", &written));
+  assertEqual((size_t) 4, written);
+  assertEqual(0, memcmp(t, "foob", 4));
+
+  assertEqual(0, base64Decode(t, sizeof(t), "Zm9vYmE", &written));
+  assertEqual((size_t) 5, written);
+  assertEqual(0, memcmp(t, "fooba", 5));
+}
+
+test(base64Decode, allBytes) {
+  uint8_t s[256];
+  for (int i = 0; i < 256; i++) {
+    s[i] = i;
+  }
+  char encoded[4 * 86 + 1];
+  assertEqual(0, base64Encode(encoded, sizeof(encoded), s, sizeof(s), nullptr));
+
+  uint8_t t[256];
+  size_t written;
+  assertEqual(0, base64Decode(t, sizeof(t), encoded, &written));
+  assertEqual((size_t) 256, written);
+  assertEqual(0, memcmp(s, t, sizeof(s)));
+}
+
+test(base64Decode, tooLong) {
+  uint8_t t[4];
+  size_t written;
+  uint8_t status = base64Decode(t, sizeof(t), "Zm9vYmFy", &written);
+  assertEqual(status, 1);
+  assertEqual((size_t) 3, written);
+
+  status = base64Decode(t, sizeof(t), "Zm9vYmE=", &written);
+  assertEqual(status, 1);
+  assertEqual((size_t) 3, written);
+}
+
+test(base64Decode, illFormed) {
+  uint8_t t[16];
+  size_t written;
+
+  // Invalid characters, including the Base64url characters.
+  assertEqual(2, base64Decode(t, sizeof(t), "Zm9v!mFy", &written));
+  assertEqual((size_t) 3, written);
+  assertEqual(2, base64Decode(t, sizeof(t), "Zm9-", &written));
+  assertEqual(2, base64Decode(t, sizeof(t), "Zm9_", &written));
+  assertEqual(2, base64Decode(t, sizeof(t), "Zm 9", &written));
+
+  // A single dangling character.
+  assertEqual(2, base64Decode(t, sizeof(t), "Zm9vY", &written));
+
+  // Incorrect padding.
+  assertEqual(2, base64Decode(t, sizeof(t), "Zg=", &written));
+  assertEqual(2, base64Decode(t, sizeof(t), "Zm8==", &written));
+  assertEqual(2, base64Decode(t, sizeof(t), "Zg==Zg==", &written));
+  assertEqual(2, base64Decode(t, sizeof(t), "====", &written));
+}
+
+//----------------------------------------------------------------------------
+// Test base64UrlEncode() and base64UrlDecode()
+//----------------------------------------------------------------------------
+
+static const uint8_t URL_BYTES[] = {0xfb, 0xff, 0xbf, 0xfe};
+
+test(base64UrlEncode, normal) {
+  char t[16];
+  size_t written;
+  uint8_t status = base64UrlEncode(
+      t, sizeof(t), URL_BYTES, sizeof(URL_BYTES), &written);
+  assertEqual(status, 0);
+  assertEqual((size_t) 6, written);
+  assertEqual("-_-__g", t);
+
+  // Compare with the Base64 alphabet.
+  base64Encode(t, sizeof(t), URL_BYTES, sizeof(URL_BYTES), &written);
+  assertEqual("+/+//g==", t);
+}
+
+test(base64UrlEncode, tooLong) {
+  char t[6];
+  size_t written;
+  uint8_t status = base64UrlEncode(
+      t, sizeof(t), URL_BYTES, sizeof(URL_BYTES), &written);
+  assertEqual(status, 1);
+  assertEqual((size_t) 4, written);
+  assertEqual("-_-_", t);
+}
+
+test(base64UrlDecode, normal) {
+  uint8_t t[16];
+  size_t written;
+
+  assertEqual(0, base64UrlDecode(t, sizeof(t), "-_-__g", &written));
+  assertEqual((size_t) 4, written);
+  assertEqual(0, memcmp(t, URL_BYTES, sizeof(URL_BYTES)));
+
+  // Padding is accepted.
+  assertEqual(0, base64UrlDecode(t, sizeof(t), "-_-__g==", &written));
+  assertEqual((size_t) 4, written);
+
+  // The Base64 characters are not.
+  assertEqual(2, base64UrlDecode(t, sizeof(t), "+/+//g", &written));
+}
+
+//----------------------------------------------------------------------------
+// Test printBase64To() and printBase64UrlTo()
+//----------------------------------------------------------------------------
+
+test(printBase64To, normal) {
+  PrintStr<16> printStr;
+  size_t n = printBase64To(printStr, "foobar", 6);
+  assertEqual((size_t) 8, n);
+  assertEqual("Zm9vYmFy", printStr.cstr());
+
+  printStr.flush();
+  printBase64To(printStr, "fooba", 5);
+  assertEqual("Zm9vYmE=", printStr.cstr());
+
+  printStr.flush();
+  printBase64UrlTo(printStr, URL_BYTES, sizeof(URL_BYTES));
+  assertEqual("-_-__g", printStr.cstr());
+}
+
+test(printBase64To, multipleBlocks) {
+  // Larger than the internal buffer of printBase64To().
+  uint8_t s[100];
+  for (uint8_t i = 0; i < sizeof(s); i++) {
+    s[i] = i * 7;
+  }
+  char expected[4 * 34 + 1];
+  base64Encode(expected, sizeof(expected), s, sizeof(s), nullptr);
+
+  PrintStr<150> printStr;
+  size_t n = printBase64To(printStr, s, sizeof(s));
+  assertEqual((size_t) 136, n);
+  assertEqual(expected, printStr.cstr());
+}
+
+test(printBase64To, outOfBounds) {
+  PrintStr<6> printStr;
+  size_t n = printBase64To(printStr, "foobar", 6);
+  assertEqual((size_t) 5, n);
+  assertEqual("Zm9vY", printStr.cstr());
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
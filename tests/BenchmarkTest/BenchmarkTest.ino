@@ -0,0 +1,193 @@
+#line 2 "BenchmarkTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using aunit::TestRunner;
+using ace_common::Benchmark;
+using ace_common::BenchmarkT;
+using ace_common::GenericStats;
+using ace_common::PrintStr;
+using ace_common::TimingHistogram;
+using ace_common::TimingStatsT;
+using ace_common::doNotOptimize;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+/**
+ * A clock which only advances when the benchmarked code tells it to, to get
+ * deterministic results. One tick is one micro.
+ */
+class FakeClock {
+  public:
+    static uint32_t now() { return sTicks; }
+    static uint32_t ticksPerMicro() { return 1; }
+    static uint32_t toNanos(uint32_t ticks) { return ticks * 1000; }
+
+    static uint32_t sTicks;
+};
+
+uint32_t FakeClock::sTicks = 0;
+
+typedef TimingStatsT<uint32_t, uint64_t> Stats;
+typedef BenchmarkT<Stats, FakeClock> FakeBenchmark;
+typedef BenchmarkT<TimingHistogram<4, 24>, FakeClock> FakeHistogramBenchmark;
+typedef BenchmarkT<GenericStats<uint32_t, uint64_t, uint16_t, true>, FakeClock>
+    FakeStdDevBenchmark;
+
+// Each iteration of the body takes 10 micros, and 2 micros of the loop.
+static void body(uint32_t /*i*/) { FakeClock::sTicks += 10; }
+static void baseline(uint32_t /*i*/) { FakeClock::sTicks += 2; }
+
+//----------------------------------------------------------------------------
+
+test(BenchmarkTest, calibrate_and_subtract_baseline) {
+  PrintStr<100> printStr;
+  FakeBenchmark benchmark(printStr);
+  benchmark.setSampleMicros(1000);
+  benchmark.setSamples(5);
+  benchmark.run(F("body"), body, baseline);
+
+  // Doubles to 16 iterations (160 micros >= 1000/8), then scales to 1000
+  // micros.
+  assertEqual((uint32_t) 100, benchmark.getIterations());
+  assertEqual((uint32_t) 5, benchmark.getStats().getCount());
+  assertEqual((uint32_t) 800000, benchmark.getStats().getMin());
+  assertEqual("body 8.000 8.000 8.000 100 5\r\n", printStr.cstr());
+}
+
+// Advances the clock by 1 tick every 4 iterations, like a fast function
+// timed by micros().
+static void quarterTickBody(uint32_t i) {
+  if ((i & 3) == 3) FakeClock::sTicks++;
+}
+
+test(BenchmarkTest, calibrate_tiny_sample) {
+  // Before the fix, the first loop with 0 elapsed ticks was accepted when
+  // targetTicks / 8 was 0, and calibrate() divided by 0.
+  for (uint32_t micros = 0; micros < 8; micros++) {
+    PrintStr<100> printStr;
+    FakeBenchmark benchmark(printStr);
+    benchmark.setSampleMicros(micros);
+    benchmark.setSamples(1);
+    benchmark.run(F("tiny"), quarterTickBody);
+
+    // Doubles to 4 iterations (1 tick >= 8/8), then scales to 8 ticks.
+    assertEqual((uint32_t) 32, benchmark.getIterations());
+  }
+}
+
+test(BenchmarkTest, fixed_iterations) {
+  PrintStr<100> printStr;
+  FakeBenchmark benchmark(printStr);
+  benchmark.setIterations(7);
+  benchmark.setSamples(2);
+  benchmark.run(F("body"), body, baseline);
+  assertEqual((uint32_t) 7, benchmark.getIterations());
+  assertEqual("body 8.000 8.000 8.000 7 2\r\n", printStr.cstr());
+}
+
+test(BenchmarkTest, baseline_slower_than_body) {
+  PrintStr<100> printStr;
+  FakeBenchmark benchmark(printStr);
+  benchmark.setIterations(10);
+  benchmark.setSamples(1);
+  benchmark.run(F("fast"), baseline, body);
+  assertEqual("fast 0.000 0.000 0.000 10 1\r\n", printStr.cstr());
+}
+
+test(BenchmarkTest, csv) {
+  PrintStr<200> printStr;
+  FakeBenchmark benchmark(printStr, FakeBenchmark::kFormatCsv);
+  benchmark.setIterations(10);
+  benchmark.setSamples(1);
+  benchmark.run(F("a"), body, baseline);
+  benchmark.run(F("b"), body, baseline);
+  assertEqual(
+      "name,minNanos,avgNanos,maxNanos,iterations,samples\r\n"
+      "a,8000.000,8000.000,8000.000,10,1\r\n"
+      "b,8000.000,8000.000,8000.000,10,1\r\n",
+      printStr.cstr());
+}
+
+test(BenchmarkTest, json_with_percentiles) {
+  PrintStr<200> printStr;
+  FakeHistogramBenchmark benchmark(
+      printStr, FakeHistogramBenchmark::kFormatJson);
+  benchmark.setIterations(10);
+  benchmark.setSamples(1);
+  benchmark.run(F("say \"hi\""), body, baseline);
+  assertEqual(
+      "{\"name\":\"say \\\"hi\\\"\",\"minNanos\":8000.000,"
+      "\"avgNanos\":8000.000,\"maxNanos\":8000.000,\"iterations\":10,"
+      "\"samples\":1,\"p50Nanos\":8000.000,\"p95Nanos\":8000.000}\r\n",
+      printStr.cstr());
+}
+
+test(BenchmarkTest, csv_with_std_dev) {
+  PrintStr<200> printStr;
+  FakeStdDevBenchmark benchmark(printStr, FakeStdDevBenchmark::kFormatCsv);
+  benchmark.setIterations(3);
+  benchmark.setSamples(2);
+  benchmark.run(F("a"), body, baseline);
+  assertEqual(
+      "name,minNanos,avgNanos,maxNanos,iterations,samples,stdDevNanos\r\n"
+      "a,8000.000,8000.000,8000.000,3,2,0.000\r\n",
+      printStr.cstr());
+}
+
+test(BenchmarkTest, json_sub_nanosecond) {
+  PrintStr<200> printStr;
+  FakeBenchmark benchmark(printStr, FakeBenchmark::kFormatJson);
+  benchmark.setIterations(3000);
+  benchmark.setSamples(1);
+  // 1 micro of difference over 3000 iterations is 0.333 nanos.
+  benchmark.run(F("a"),
+      [](uint32_t i) { if (i == 0) FakeClock::sTicks += 1; },
+      [](uint32_t /*i*/) {});
+  assertEqual(
+      "{\"name\":\"a\",\"minNanos\":0.333,\"avgNanos\":0.333,"
+      "\"maxNanos\":0.333,\"iterations\":3000,\"samples\":1}\r\n",
+      printStr.cstr());
+}
+
+test(BenchmarkTest, text_with_percentiles) {
+  PrintStr<100> printStr;
+  FakeHistogramBenchmark benchmark(printStr);
+  benchmark.setIterations(10);
+  benchmark.setSamples(3);
+  benchmark.run(F("body"), body, baseline);
+  assertEqual("body 8.000 8.000 8.000 10 3 8.000 8.000\r\n", printStr.cstr());
+}
+
+test(BenchmarkTest, real_clock) {
+  PrintStr<100> printStr;
+  Benchmark benchmark(printStr);
+  benchmark.setSampleMicros(1000);
+  benchmark.setSamples(2);
+  benchmark.run(F("xor"), [](uint32_t i) { doNotOptimize(i ^ 0x55); });
+  assertMore(benchmark.getIterations(), (uint32_t) 1);
+  assertEqual((uint32_t) 2, benchmark.getStats().getCount());
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}
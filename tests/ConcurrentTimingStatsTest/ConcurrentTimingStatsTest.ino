@@ -0,0 +1,142 @@
+#line 2 "ConcurrentTimingStatsTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+#if defined(EPOXY_DUINO)
+  #include <thread>
+#endif
+
+using aunit::TestRunner;
+using ace_common::ConcurrentTimingStats;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+typedef ConcurrentTimingStats<2> Stats;
+
+//----------------------------------------------------------------------------
+// Test ConcurrentTimingStats
+//----------------------------------------------------------------------------
+
+test(ConcurrentTimingStatsTest, empty) {
+  Stats stats;
+  Stats::Stats snapshot = stats.getSnapshot();
+  assertEqual((uint32_t) 0, snapshot.getCount());
+  assertEqual((uint32_t) 0, snapshot.getAvg());
+}
+
+test(ConcurrentTimingStatsTest, shards) {
+  Stats stats;
+  stats.update(10, 0);
+  stats.update(20, 0);
+  stats.update(100000, 1);
+
+  Stats::Stats shard;
+  stats.readShard(0, shard);
+  assertEqual((uint32_t) 2, shard.getCount());
+  assertEqual((uint32_t) 20, shard.getMax());
+  stats.readShard(1, shard);
+  assertEqual((uint32_t) 1, shard.getCount());
+  assertEqual((uint32_t) 100000, shard.getMax());
+
+  Stats::Stats snapshot = stats.getSnapshot();
+  assertEqual((uint32_t) 3, snapshot.getCount());
+  assertEqual((uint32_t) 3, snapshot.getCounter());
+  assertEqual((uint32_t) 10, snapshot.getMin());
+  assertEqual((uint32_t) 100000, snapshot.getMax());
+  assertEqual((uint64_t) 100030, snapshot.getSum());
+  assertEqual((uint32_t) 33343, snapshot.getAvg());
+}
+
+#if ACE_COMMON_CACHE_LINE_SIZE > 0
+test(ConcurrentTimingStatsTest, cacheLinePadding) {
+  // Each shard is at least one cache line, so the shards never share a line.
+  assertMoreOrEqual(sizeof(Stats), (size_t) 2 * ACE_COMMON_CACHE_LINE_SIZE);
+  assertEqual((size_t) 0, sizeof(Stats) % ACE_COMMON_CACHE_LINE_SIZE);
+}
+#endif
+
+#if defined(EPOXY_DUINO)
+
+static const uint8_t kNumWriters = 4;
+static const uint32_t kNumUpdates = 200000;
+
+// Each writer thread updates its own shard with a constant duration, so a
+// torn copy of a shard would show a sum which does not match its count.
+test(ConcurrentTimingStatsTest, multipleWriters) {
+  static ConcurrentTimingStats<kNumWriters> stats;
+  typedef ConcurrentTimingStats<kNumWriters>::Stats ShardStats;
+
+  std::thread writers[kNumWriters];
+  for (uint8_t i = 0; i < kNumWriters; i++) {
+    writers[i] = std::thread([i]() {
+      for (uint32_t n = 0; n < kNumUpdates; n++) {
+        stats.update(i + 1, i);
+      }
+    });
+  }
+
+  uint32_t torn = 0;
+  ShardStats shard;
+  for (uint32_t n = 0; n < 20000; n++) {
+    uint8_t i = n % kNumWriters;
+    stats.readShard(i, shard);
+    if (shard.getSum() != (uint64_t) shard.getCount() * (i + 1)) torn++;
+    if (shard.getCount() > 0 && shard.getMax() != i + 1u) torn++;
+  }
+
+  for (uint8_t i = 0; i < kNumWriters; i++) {
+    writers[i].join();
+  }
+  assertEqual((uint32_t) 0, torn);
+
+  ShardStats snapshot = stats.getSnapshot();
+  assertEqual(kNumWriters * kNumUpdates, snapshot.getCount());
+  assertEqual((uint64_t) kNumUpdates * (1 + 2 + 3 + 4), snapshot.getSum());
+  assertEqual((uint32_t) 1, snapshot.getMin());
+  assertEqual((uint32_t) kNumWriters, snapshot.getMax());
+}
+
+#endif
+
+test(ConcurrentTimingStatsTest, reset) {
+  Stats stats;
+  stats.update(10, 0);
+  stats.update(20, 1);
+
+  // The shards are treated as empty until their next update().
+  stats.reset();
+  Stats::Stats snapshot = stats.getSnapshot();
+  assertEqual((uint32_t) 0, snapshot.getCount());
+  assertEqual((uint32_t) 2, snapshot.getCounter());
+
+  stats.update(30, 0);
+  snapshot = stats.getSnapshot();
+  assertEqual((uint32_t) 1, snapshot.getCount());
+  assertEqual((uint32_t) 3, snapshot.getCounter());
+  assertEqual((uint32_t) 30, snapshot.getMin());
+  assertEqual((uint32_t) 30, snapshot.getMax());
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}
@@ -6,6 +6,11 @@
 using aunit::TestRunner;
 using ace_common::copyReplaceChar;
 using ace_common::copyReplaceString;
+using ace_common::copyReplaceStringLength;
+using ace_common::copyReplaceChars;
+using ace_common::copyReplacePatterns;
+using ace_common::CharReplacer;
+using ace_common::PatternReplacer;
 
 //----------------------------------------------------------------------------
 // copyReplaceChar(char*)
@@ -163,6 +168,137 @@ test(copyReplaceString, outOfBounds_flash_flash) {
   assertEqual("Es", dst);
 }
 
+//---------------------------------------------------------------------------
+// Returned length, and copyReplaceStringLength()
+//---------------------------------------------------------------------------
+
+test(copyReplaceChar, returnLength) {
+  const uint8_t dstSize = 3;
+  char dst[dstSize];
+
+  assertEqual((size_t) 2, copyReplaceChar(dst, dstSize, "E%", '%', 's'));
+  assertEqual("Es", dst);
+
+  // Truncated, so the return value is >= dstSize.
+  assertEqual((size_t) 5, copyReplaceChar(dst, dstSize, "E%T%Z", '%', 's'));
+  assertEqual("Es", dst);
+  assertEqual((size_t) 3,
+      copyReplaceChar(dst, dstSize, F("E%T%Z"), '%', '\0'));
+  assertEqual("ET", dst);
+}
+
+test(copyReplaceString, returnLength) {
+  const uint8_t dstSize = 3;
+  char dst[dstSize];
+
+  assertEqual((size_t) 9,
+      copyReplaceString(dst, dstSize, "E%T%Z", '%', "suv"));
+  assertEqual("Es", dst);
+  assertEqual((size_t) 9,
+      copyReplaceString(dst, dstSize, "E%T%Z", '%', F("suv")));
+  assertEqual("Es", dst);
+  assertEqual((size_t) 9,
+      copyReplaceString(dst, dstSize, F("E%T%Z"), '%', "suv"));
+  assertEqual("Es", dst);
+  assertEqual((size_t) 9,
+      copyReplaceString(dst, dstSize, F("E%T%Z"), '%', F("suv")));
+  assertEqual("Es", dst);
+  assertEqual((size_t) 0, copyReplaceString(dst, dstSize, "", '%', "suv"));
+  assertEqual("", dst);
+}
+
+test(copyReplaceStringLength, normal) {
+  assertEqual((size_t) 9, copyReplaceStringLength("NOREPLACE", '%', "suv"));
+  assertEqual((size_t) 9, copyReplaceStringLength("E%T%Z", '%', "suv"));
+  assertEqual((size_t) 9, copyReplaceStringLength("E%T%Z", '%', F("suv")));
+  assertEqual((size_t) 9, copyReplaceStringLength(F("E%T%Z"), '%', "suv"));
+  assertEqual((size_t) 9,
+      copyReplaceStringLength(F("E%T%Z"), '%', F("suv")));
+  assertEqual((size_t) 3, copyReplaceStringLength("E%T%Z", '%', ""));
+  assertEqual((size_t) 0, copyReplaceStringLength("", '%', "suv"));
+}
+
+test(copyReplaceStringLength, exactSize) {
+  const char src[] = "a%b%%c";
+  size_t length = copyReplaceStringLength(src, '%', "xyz");
+  assertEqual((size_t) 12, length);
+
+  char dst[13];
+  assertEqual(length, copyReplaceString(dst, length + 1, src, '%', "xyz"));
+  assertEqual("axyzbxyzxyzc", dst);
+}
+
+//---------------------------------------------------------------------------
+// copyReplaceChars()
+//---------------------------------------------------------------------------
+
+static const char* const HTML_ESCAPES[] = {
+  "&amp;", "&lt;", "&gt;", "&quot;", "&#39;"
+};
+
+test(copyReplaceChars, normal) {
+  CharReplacer replacer("&<>\"'", HTML_ESCAPES);
+  const uint8_t dstSize = 40;
+  char dst[dstSize];
+
+  copyReplaceChars(dst, dstSize, "NOREPLACE", replacer);
+  assertEqual("NOREPLACE", dst);
+
+  copyReplaceChars(dst, dstSize, "a<b>'c'", replacer);
+  assertEqual("a&lt;b&gt;&#39;c&#39;", dst);
+
+  copyReplaceChars(dst, dstSize, F("a<b>'c'"), replacer);
+  assertEqual("a&lt;b&gt;&#39;c&#39;", dst);
+}
+
+test(copyReplaceChars, outOfBounds) {
+  CharReplacer replacer("&<>\"'", HTML_ESCAPES);
+  const uint8_t dstSize = 5;
+  char dst[dstSize];
+
+  assertEqual((size_t) 6, copyReplaceChars(dst, dstSize, "a<b", replacer));
+  assertEqual("a&lt", dst);
+
+  copyReplaceChars(dst, dstSize, F("a<b"), replacer);
+  assertEqual("a&lt", dst);
+}
+
+//---------------------------------------------------------------------------
+// copyReplacePatterns()
+//---------------------------------------------------------------------------
+
+static const char* const PATTERNS[] = {"%%", "%s", "</"};
+static const char* const REPLACEMENTS[] = {"%", "str", "<\\/"};
+
+test(copyReplacePatterns, normal) {
+  PatternReplacer<6> replacer(PATTERNS, REPLACEMENTS, 3);
+  assertTrue(replacer.isValid());
+  const uint8_t dstSize = 40;
+  char dst[dstSize];
+
+  copyReplacePatterns(dst, dstSize, "NOREPLACE", replacer);
+  assertEqual("NOREPLACE", dst);
+
+  copyReplacePatterns(dst, dstSize, "%%s %s</b><", replacer);
+  assertEqual("%s str<\\/b><", dst);
+
+  copyReplacePatterns(dst, dstSize, F("%%s %s</b><"), replacer);
+  assertEqual("%s str<\\/b><", dst);
+}
+
+test(copyReplacePatterns, outOfBounds) {
+  PatternReplacer<6> replacer(PATTERNS, REPLACEMENTS, 3);
+  const uint8_t dstSize = 4;
+  char dst[dstSize];
+
+  assertEqual((size_t) 5,
+      copyReplacePatterns(dst, dstSize, "a%sb", replacer));
+  assertEqual("ast", dst);
+
+  copyReplacePatterns(dst, dstSize, F("a%sb"), replacer);
+  assertEqual("ast", dst);
+}
+
 // ---------------------------------------------------------------------------
 
 void setup() {
@@ -0,0 +1,66 @@
+#line 2 "CycleClockTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using aunit::TestRunner;
+using ace_common::CycleClock;
+using ace_common::MicrosClock;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+//----------------------------------------------------------------------------
+// Test CycleClock
+//----------------------------------------------------------------------------
+
+test(CycleClockTest, conversions) {
+  assertEqual((uint32_t) 7, MicrosClock::toMicros(7));
+  assertEqual((uint32_t) 7000, MicrosClock::toNanos(7));
+
+  uint32_t tpm = CycleClock::ticksPerMicro();
+  assertMore(tpm, (uint32_t) 0);
+  assertEqual((uint32_t) 3, CycleClock::toMicros(3 * tpm));
+  assertEqual((uint32_t) 3000, CycleClock::toNanos(3 * tpm));
+}
+
+test(CycleClockTest, toNanos_saturates) {
+  // 4294967 micros is the largest number which fits in 32-bit nanos.
+  assertEqual((uint32_t) 4294967000UL, MicrosClock::toNanos(4294967));
+  assertEqual((uint32_t) UINT32_MAX, MicrosClock::toNanos(4294968));
+  assertEqual((uint32_t) UINT32_MAX, MicrosClock::toNanos(10000000));
+  assertEqual((uint32_t) UINT32_MAX, MicrosClock::toNanos(UINT32_MAX));
+
+  // Every processor has at most 1000 ticks per micro (1 GHz), so the largest
+  // number of ticks is at least 4.29 seconds.
+  assertEqual((uint32_t) UINT32_MAX, CycleClock::toNanos(UINT32_MAX));
+}
+
+test(CycleClockTest, now_advances) {
+  CycleClock::begin();
+  uint32_t start = CycleClock::now();
+  delayMicroseconds(50);
+  uint32_t elapsed = CycleClock::now() - start;
+  assertMoreOrEqual(CycleClock::toMicros(elapsed), (uint32_t) 49);
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}
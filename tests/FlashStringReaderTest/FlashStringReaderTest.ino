@@ -0,0 +1,144 @@
+#line 2 "FlashStringReaderTest.ino"
+
+/*
+ * Compiled with -DACE_COMMON_FLASH_READER_BLOCK_SIZE=4 and
+ * -DACE_COMMON_UNIFIED_FLASH=0 by the Makefile, so that the library functions
+ * which scan flash strings use the FlashStringReaderT<4> instead of the
+ * FlashString or the plain `const char*` on this platform.
+ */
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+#if ACE_COMMON_FLASH_READER_BLOCK_SIZE != 4
+  #error This test must be compiled with -DACE_COMMON_FLASH_READER_BLOCK_SIZE=4
+#endif
+
+#if ACE_COMMON_UNIFIED_FLASH
+  #error This test must be compiled with -DACE_COMMON_UNIFIED_FLASH=0
+#endif
+
+// Aligned to the largest BlockSize, and padded to a multiple of it, so that
+// every block read by the readers lies inside the array.
+alignas(32) static const char TEXT[64] PROGMEM =
+    "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static const __FlashStringHelper* textAt(size_t offset) {
+  return (const __FlashStringHelper*) (TEXT + offset);
+}
+
+// Read the string starting at every offset of the first 2 blocks, using the
+// *s++ idiom, and compare against pgm_read_byte().
+template <uint8_t BlockSize>
+static bool readsText() {
+  for (size_t offset = 0; offset < 2 * BlockSize; offset++) {
+    FlashStringReaderT<BlockSize> reader(textAt(offset));
+    const char* p = TEXT + offset;
+    while (true) {
+      char expected = (char) pgm_read_byte(p++);
+      char c = *reader++;
+      if (c != expected) return false;
+      if (c == '\0') break;
+    }
+    if ((const void*) reader != (const void*) p) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// FlashStringReaderT
+//----------------------------------------------------------------------------
+
+test(FlashStringReaderTest, readsText) {
+  assertTrue(readsText<4>());
+  assertTrue(readsText<8>());
+  assertTrue(readsText<16>());
+  assertTrue(readsText<32>());
+}
+
+test(FlashStringReaderTest, incrementAndDecrement) {
+  FlashStringReaderT<4> reader(textAt(3));
+  assertEqual('3', *reader);
+  assertEqual('4', *++reader);
+  assertEqual('4', *reader++);
+  assertEqual('5', *reader);
+  assertEqual('4', *--reader);
+  assertEqual('4', *reader--);
+  assertEqual('3', *reader);
+
+  reader += 10;
+  assertEqual('d', *reader);
+  assertEqual('d', reader[0]);
+  assertEqual('f', reader[2]);
+}
+
+test(FlashStringReaderTest, copyKeepsPosition) {
+  FlashStringReaderT<16> reader(textAt(14));
+  assertEqual('e', *reader);
+  FlashStringReaderT<16> copy = reader;
+  ++copy;
+  ++copy;
+  assertEqual('g', *copy);
+  assertEqual('e', *reader);
+}
+
+test(FlashStringReaderTest, casts) {
+  FlashStringReaderT<4> reader(textAt(5));
+  assertEqual(textAt(5), (const __FlashStringHelper*) reader);
+  assertTrue(reader != nullptr);
+  assertTrue(reader == (const void*) (TEXT + 5));
+}
+
+//----------------------------------------------------------------------------
+// Library functions which use FlashStringReader
+//----------------------------------------------------------------------------
+
+test(FlashStringReaderTest, hashDjb2) {
+  assertEqual(hashDjb2("abcd"), hashDjb2(F("abcd")));
+  assertEqual(hashDjb2(TEXT), hashDjb2(textAt(0)));
+  assertEqual(hashDjb2(TEXT + 7), hashDjb2(textAt(7)));
+}
+
+test(FlashStringReaderTest, copyReplaceString) {
+  char dst[80];
+  assertEqual((size_t) 7,
+      copyReplaceString(dst, sizeof(dst), F("a,b,c"), ',', F("--")));
+  assertEqual("a--b--c", dst);
+
+  assertEqual((size_t) 60, copyReplaceChar(
+      dst, sizeof(dst), textAt(1), '5', '\0'));
+  assertEqual((size_t) 62, copyReplaceStringLength(textAt(0), 'z', "Z"));
+}
+
+test(FlashStringReaderTest, compareFlashStrings) {
+  assertEqual(0, strcmp_PP(TEXT + 3, TEXT + 3));
+  assertLess(strcmp_PP(TEXT, TEXT + 1), 0);
+  assertMore(strcmp_PP(TEXT + 1, TEXT), 0);
+
+  FCString a(F("abcdefgh"));
+  FCString b(F("abcdefgi"));
+  assertLess(a.compareTo(b), 0);
+  assertEqual(0, a.compareTo(FCString(F("abcdefgh"))));
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
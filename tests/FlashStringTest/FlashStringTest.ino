@@ -5,6 +5,7 @@
 
 using aunit::TestRunner;
 using ace_common::FlashString;
+using ace_common::FlashStringReader;
 
 // ---------------------------------------------------------------------------
 
@@ -84,6 +85,18 @@ test(FlashString, comparisons_work_by_casting) {
 
 // ---------------------------------------------------------------------------
 
+test(FlashString, unifiedFlash) {
+#if ACE_COMMON_UNIFIED_FLASH && ACE_COMMON_FLASH_READER_BLOCK_SIZE == 0
+  // The f-string is a normal pointer, and its reader is that pointer.
+  const __FlashStringHelper* fs = F("the string");
+  const char* s = FlashStringReader(fs);
+  assertEqual((const char*) fs, s);
+  assertEqual('t', *s);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+
 void setup() {
 #if ! defined(EPOXY_DUINO)
   delay(1000); // some boards reboot twice
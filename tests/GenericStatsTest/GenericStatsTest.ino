@@ -91,6 +91,120 @@ test(GenericStatsTest, reset) {
   assertEqual((uint16_t) 4, stats.getCounter());
 }
 
+test(GenericStatsTest, largerSumAndCount) {
+  GenericStats<uint16_t, uint32_t, uint32_t> stats;
+  for (uint32_t i = 0; i < 70000; i++) {
+    stats.update(60000);
+  }
+
+  assertEqual((uint32_t) 70000, stats.getCount());
+  assertEqual((uint32_t) 4200000000UL, stats.getSum());
+  assertEqual((uint16_t) 60000, stats.getAvg());
+}
+
+test(GenericStatsTest, variance) {
+  GenericStats<float, float, uint16_t, true> stats;
+  assertEqual(0.0, stats.getVariance());
+  stats.update(2.0);
+  assertEqual(0.0, stats.getVariance());
+
+  stats.update(4.0);
+  stats.update(4.0);
+  stats.update(4.0);
+  stats.update(5.0);
+  stats.update(5.0);
+  stats.update(7.0);
+  stats.update(9.0);
+
+  // mean = 5, sum of squared differences = 32
+  assertNear(32.0 / 7, stats.getVariance(), 1e-5);
+  assertNear(sqrt(32.0 / 7), stats.getStdDev(), 1e-5);
+  assertNear(sqrt(32.0 / 7) / 5, stats.getCoefficientOfVariation(), 1e-5);
+}
+
+test(GenericStatsTest, variance_largeOffset) {
+  // The naive sum-of-squares formula loses all precision here when double is
+  // a 4-byte float.
+  GenericStats<uint32_t, uint64_t, uint16_t, true> stats;
+  stats.update(1000004UL);
+  stats.update(1000007UL);
+  stats.update(1000013UL);
+  stats.update(1000016UL);
+
+  assertEqual((uint32_t) 1000010UL, stats.getAvg());
+  assertNear(30.0, stats.getVariance(), 1e-3);
+}
+
+test(GenericStatsTest, coefficientOfVariation_zeroMean) {
+  GenericStats<int16_t, int16_t, uint16_t, true> stats;
+  stats.update(-10);
+  stats.update(10);
+  assertEqual(0.0, stats.getCoefficientOfVariation());
+  assertNear(200.0, stats.getVariance(), 1e-3);
+}
+
+test(GenericStatsTest, expDecayShift) {
+  GenericStats<uint16_t> stats(2);
+  assertEqual(2, stats.getExpDecayShift());
+
+  // alpha = 1/4
+  stats.update(100);
+  stats.update(200);
+  assertEqual((uint16_t) 125, stats.getExpDecayAvg());
+
+  // Decreasing values do not underflow an unsigned type.
+  stats.update(25);
+  assertEqual((uint16_t) 100, stats.getExpDecayAvg());
+
+  stats.setExpDecayShift(1);
+  stats.update(0);
+  assertEqual((uint16_t) 50, stats.getExpDecayAvg());
+
+  GenericStats<float> floatStats(3);
+  floatStats.update(0.0);
+  floatStats.update(8.0);
+  assertEqual(1.0, floatStats.getExpDecayAvg());
+}
+
+test(GenericStatsTest, expDecayAvg_signed) {
+  // The difference 100 - (-100) does not fit in an int8_t.
+  GenericStats<int8_t, int16_t> stats;
+  stats.update(-100);
+  stats.update(100);
+  assertEqual((int8_t) 0, stats.getExpDecayAvg());
+  stats.update(-128);
+  assertEqual((int8_t) -64, stats.getExpDecayAvg());
+  stats.update(127);
+  assertEqual((int8_t) 31, stats.getExpDecayAvg());
+
+  GenericStats<int32_t, int64_t> stats32(1);
+  stats32.update(INT32_MIN);
+  stats32.update(INT32_MAX);
+  assertEqual((int32_t) -1, stats32.getExpDecayAvg());
+}
+
+test(GenericStatsTest, variance_countWrapsAround) {
+  GenericStats<uint16_t, uint32_t, uint16_t, true> stats;
+  for (uint32_t i = 0; i < 70000; i++) {
+    stats.update((i & 1) ? 20 : 10);
+  }
+
+  // The 16-bit count wrapped after 65536 updates, and the statistics
+  // restarted with the remaining 4464 values, without a division by 0.
+  assertEqual((uint16_t) 4464, stats.getCount());
+  double variance = stats.getVariance();
+  assertFalse(isnan(variance));
+  assertNear(25.0 * 4464 / 4463, variance, 1e-6);
+  assertNear(sqrt(25.0 * 4464 / 4463) / 15, stats.getCoefficientOfVariation(),
+      1e-6);
+}
+
+test(GenericStatsTest, variance_disabledBySize) {
+  // Without the variance, there are no double fields.
+  assertLess(sizeof(GenericStats<uint16_t>),
+      sizeof(GenericStats<uint16_t, uint16_t, uint16_t, true>));
+}
+
 //----------------------------------------------------------------------------
 // setup() and loop()
 //----------------------------------------------------------------------------
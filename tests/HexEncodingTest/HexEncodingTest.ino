@@ -0,0 +1,154 @@
+#line 2 "HexEncodingTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+static const uint8_t BYTES[] = {0x01, 0x9a, 0xef, 0x00, 0x7F};
+
+//----------------------------------------------------------------------------
+// Test hexEncode()
+//----------------------------------------------------------------------------
+
+test(hexEncode, normal) {
+  char t[16];
+  size_t written;
+  uint8_t status = hexEncode(t, sizeof(t), BYTES, sizeof(BYTES), &written);
+  assertEqual(status, 0);
+  assertEqual(written, (size_t) 10);
+  assertEqual("019AEF007F", t);
+}
+
+test(hexEncode, lowerCase) {
+  char t[16];
+  uint8_t status = hexEncode(t, sizeof(t), BYTES, sizeof(BYTES), nullptr, 'a');
+  assertEqual(status, 0);
+  assertEqual("019aef007f", t);
+}
+
+test(hexEncode, empty) {
+  char t[4];
+  size_t written;
+  uint8_t status = hexEncode(t, sizeof(t), BYTES, 0, &written);
+  assertEqual(status, 0);
+  assertEqual(written, (size_t) 0);
+  assertEqual("", t);
+}
+
+test(hexEncode, tooLong) {
+  // Room for only 2 complete bytes and the NUL terminator.
+  char t[6];
+  size_t written;
+  uint8_t status = hexEncode(t, sizeof(t), BYTES, sizeof(BYTES), &written);
+  assertEqual(status, 1);
+  assertEqual(written, (size_t) 4);
+  assertEqual("019A", t);
+}
+
+//----------------------------------------------------------------------------
+// Test hexDecode()
+//----------------------------------------------------------------------------
+
+test(hexDecode, normal) {
+  uint8_t t[8];
+  size_t written;
+  uint8_t status = hexDecode(t, sizeof(t), "019AeF007f", &written);
+  assertEqual(status, 0);
+  assertEqual(written, (size_t) 5);
+  assertEqual(0, memcmp(t, BYTES, sizeof(BYTES)));
+}
+
+test(hexDecode, tooLong) {
+  uint8_t t[2];
+  size_t written;
+  uint8_t status = hexDecode(t, sizeof(t), "019AEF", &written);
+  assertEqual(status, 1);
+  assertEqual(written, (size_t) 2);
+  assertEqual(t[0], 0x01);
+  assertEqual(t[1], 0x9a);
+}
+
+test(hexDecode, oddLength) {
+  uint8_t t[8];
+  size_t written;
+  uint8_t status = hexDecode(t, sizeof(t), "019", &written);
+  assertEqual(status, 2);
+  assertEqual(written, (size_t) 1);
+}
+
+test(hexDecode, invalidHex) {
+  uint8_t t[8];
+  size_t written;
+  uint8_t status = hexDecode(t, sizeof(t), "01G9", &written);
+  assertEqual(status, 2);
+  assertEqual(written, (size_t) 1);
+
+  status = hexDecode(t, sizeof(t), "019G", &written);
+  assertEqual(status, 2);
+  assertEqual(written, (size_t) 1);
+
+  status = hexDecode(t, sizeof(t), "01\xC0" "0", &written);
+  assertEqual(status, 2);
+  assertEqual(written, (size_t) 1);
+}
+
+//----------------------------------------------------------------------------
+// Test printHexTo()
+//----------------------------------------------------------------------------
+
+test(printHexTo, normal) {
+  PrintStr<16> printStr;
+  size_t n = printHexTo(printStr, BYTES, sizeof(BYTES));
+  assertEqual(n, (size_t) 10);
+  assertEqual("019AEF007F", printStr.cstr());
+
+  printStr.flush();
+  printHexTo(printStr, BYTES, sizeof(BYTES), 'a');
+  assertEqual("019aef007f", printStr.cstr());
+}
+
+test(printHexTo, multipleBlocks) {
+  // Larger than the internal buffer of printHexTo().
+  uint8_t bytes[40];
+  for (uint8_t i = 0; i < sizeof(bytes); i++) {
+    bytes[i] = i;
+  }
+  PrintStr<100> printStr;
+  size_t n = printHexTo(printStr, bytes, sizeof(bytes));
+  assertEqual(n, (size_t) 80);
+  assertEqual(
+      "000102030405060708090A0B0C0D0E0F"
+      "101112131415161718191A1B1C1D1E1F"
+      "2021222324252627",
+      printStr.cstr());
+}
+
+test(printHexTo, outOfBounds) {
+  PrintStr<6> printStr;
+  size_t n = printHexTo(printStr, BYTES, sizeof(BYTES));
+  assertEqual(n, (size_t) 5);
+  assertEqual("019AE", printStr.cstr());
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
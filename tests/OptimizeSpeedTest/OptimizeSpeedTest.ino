@@ -0,0 +1,132 @@
+#line 2 "OptimizeSpeedTest.ino"
+
+/*
+ * Compiled with -DACE_COMMON_OPTIMIZE_SPEED by the Makefile. Verifies that
+ * the table-driven implementations selected by this policy produce the same
+ * results as the default ones.
+ */
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+#if ! defined(ACE_COMMON_OPTIMIZE_SPEED)
+  #error This test must be compiled with -DACE_COMMON_OPTIMIZE_SPEED
+#endif
+
+//----------------------------------------------------------------------------
+// Configuration selected by the policy
+//----------------------------------------------------------------------------
+
+test(OptimizeTest, configuration) {
+  assertEqual(ACE_COMMON_HEX_DECODE_TABLE, 1);
+  assertEqual(ACE_COMMON_HEX_CHAR_TABLE, 1);
+}
+
+//----------------------------------------------------------------------------
+// hex_encoding, url_encoding and backslash_x_encoding
+//----------------------------------------------------------------------------
+
+test(OptimizeTest, hexDecode) {
+  uint8_t t[8];
+  size_t written;
+  assertEqual(0, hexDecode(t, sizeof(t), "019aEF7f", &written));
+  assertEqual((size_t) 4, written);
+  assertEqual(0x01, t[0]);
+  assertEqual(0x9A, t[1]);
+  assertEqual(0xEF, t[2]);
+  assertEqual(0x7F, t[3]);
+
+  assertEqual(2, hexDecode(t, sizeof(t), "0G", &written));
+  assertEqual(2, hexDecode(t, sizeof(t), "0/", &written));
+  assertEqual(2, hexDecode(t, sizeof(t), "0:", &written));
+  assertEqual(2, hexDecode(t, sizeof(t), "0g", &written));
+  assertEqual(2, hexDecode(t, sizeof(t), "0\xff", &written));
+  assertEqual(2, hexDecode(t, sizeof(t), "012", &written));
+  assertEqual((size_t) 1, written);
+}
+
+test(OptimizeTest, hexCharToByte) {
+  assertEqual(0, hexCharToByte('0'));
+  assertEqual(9, hexCharToByte('9'));
+  assertEqual(10, hexCharToByte('A'));
+  assertEqual(15, hexCharToByte('f'));
+  assertEqual(0, hexCharToByte('G'));
+  assertEqual(0, hexCharToByte('@'));
+  assertEqual(0, hexCharToByte('\xff'));
+}
+
+test(OptimizeTest, backslashXDecode) {
+  char t[8];
+  size_t written;
+  assertEqual(0, backslashXDecode(t, sizeof(t), "a\\x41\\x7e", &written));
+  assertEqual("aA~", t);
+  assertEqual(1, backslashXDecode(t, sizeof(t), "a\\xG1", &written));
+  assertEqual((size_t) 1, written);
+  assertEqual(1, backslashXDecode(t, sizeof(t), "a\\x4", &written));
+  assertEqual((size_t) 1, written);
+  assertEqual(1, backslashXDecode(t, sizeof(t), "a\\x", &written));
+  assertEqual((size_t) 1, written);
+}
+
+//----------------------------------------------------------------------------
+// Number formatting and parsing
+//----------------------------------------------------------------------------
+
+test(OptimizeTest, formatUint) {
+  char buf[21];
+  char* end = buf + sizeof(buf) - 1;
+  *end = '\0';
+
+  assertEqual("0", formatUint(end, (uint16_t) 0));
+  assertEqual("9", formatUint(end, (uint16_t) 9));
+  assertEqual("10", formatUint(end, (uint16_t) 10));
+  assertEqual("65535", formatUint(end, (uint16_t) 65535));
+  assertEqual("65536", formatUint(end, (uint32_t) 65536UL));
+  assertEqual("4294967295", formatUint(end, (uint32_t) 4294967295UL));
+  assertEqual("18446744073709551615",
+      formatUint(end, (uint64_t) 18446744073709551615ULL));
+}
+
+test(OptimizeTest, parseUint) {
+  uint32_t value;
+  assertEqual((size_t) 10, parseUint("4294967295", 10, value));
+  assertEqual((uint32_t) 4294967295UL, value);
+  assertEqual((size_t) 9, parseUint("123456789x", 10, value));
+  assertEqual((uint32_t) 123456789UL, value);
+}
+
+test(OptimizeTest, printFloatTo) {
+  PrintStr<32> printStr;
+  printFloatTo(printStr, 0.1);
+  assertEqual("0.1", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.5e-7);
+  assertEqual("1.5e-7", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 123.25f);
+  assertEqual("123.25", printStr.cstr());
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
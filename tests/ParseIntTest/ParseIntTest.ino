@@ -0,0 +1,215 @@
+#line 2 "ParseIntTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+//----------------------------------------------------------------------------
+// SWAR kernels
+//----------------------------------------------------------------------------
+
+test(ParseIntTest, isEightDigits) {
+  uint64_t chunk;
+
+  ace_common::internal::loadChunk("01234567", chunk);
+  assertTrue(ace_common::internal::isEightDigits(chunk));
+  assertEqual((uint32_t) 1234567,
+      ace_common::internal::parseEightDigits(chunk));
+
+  ace_common::internal::loadChunk("99999999", chunk);
+  assertTrue(ace_common::internal::isEightDigits(chunk));
+  assertEqual((uint32_t) 99999999,
+      ace_common::internal::parseEightDigits(chunk));
+
+  ace_common::internal::loadChunk("1234567:", chunk);
+  assertFalse(ace_common::internal::isEightDigits(chunk));
+
+  ace_common::internal::loadChunk("/1234567", chunk);
+  assertFalse(ace_common::internal::isEightDigits(chunk));
+
+  ace_common::internal::loadChunk("1234\0" "567", chunk);
+  assertFalse(ace_common::internal::isEightDigits(chunk));
+}
+
+//----------------------------------------------------------------------------
+// parseUint()
+//----------------------------------------------------------------------------
+
+test(ParseIntTest, parseUint) {
+  uint16_t u16 = 42;
+  assertEqual((size_t) 0, parseUint("", 0, u16));
+  assertEqual((size_t) 0, parseUint("x1", 2, u16));
+  assertEqual((size_t) 0, parseUint("+1", 2, u16));
+  assertEqual((size_t) 0, parseUint(" 1", 2, u16));
+  assertEqual(42, u16);
+
+  assertEqual((size_t) 1, parseUint("0", 1, u16));
+  assertEqual(0, u16);
+  assertEqual((size_t) 4, parseUint("8080/index", 10, u16));
+  assertEqual(8080, u16);
+  assertEqual((size_t) 5, parseUint("65535", 5, u16));
+  assertEqual(65535, u16);
+
+  // The length limits the digits.
+  assertEqual((size_t) 2, parseUint("12345", 2, u16));
+  assertEqual(12, u16);
+
+  // Overflow leaves the value unchanged.
+  assertEqual((size_t) 0, parseUint("65536", 5, u16));
+  assertEqual(12, u16);
+
+  uint8_t u8;
+  assertEqual((size_t) 3, parseUint("255", 3, u8));
+  assertEqual(255, u8);
+  assertEqual((size_t) 0, parseUint("256", 3, u8));
+  assertEqual((size_t) 6, parseUint("000255", 6, u8));
+}
+
+test(ParseIntTest, parseUint_long) {
+  uint32_t u32;
+  assertEqual((size_t) 10, parseUint("4294967295", 10, u32));
+  assertEqual((uint32_t) 4294967295UL, u32);
+  assertEqual((size_t) 0, parseUint("4294967296", 10, u32));
+  assertEqual((size_t) 11, parseUint("00012345678!", 12, u32));
+  assertEqual((uint32_t) 12345678, u32);
+
+  uint64_t u64;
+  assertEqual((size_t) 20, parseUint("18446744073709551615", 20, u64));
+  assertEqual((uint64_t) 18446744073709551615ULL, u64);
+  assertEqual((size_t) 0, parseUint("18446744073709551616", 20, u64));
+  assertEqual((size_t) 0, parseUint("100000000000000000000", 21, u64));
+  assertEqual((size_t) 17, parseUint("12345678901234567,", 18, u64));
+  assertEqual((uint64_t) 12345678901234567ULL, u64);
+}
+
+test(ParseIntTest, parseUint_flash) {
+  uint32_t u32;
+  assertEqual((size_t) 9, parseUint(F("123456789"), 9, u32));
+  assertEqual((uint32_t) 123456789, u32);
+  assertEqual((size_t) 3, parseUint(F("123456789"), 3, u32));
+  assertEqual((uint32_t) 123, u32);
+}
+
+//----------------------------------------------------------------------------
+// parseInt()
+//----------------------------------------------------------------------------
+
+test(ParseIntTest, parseInt) {
+  int8_t i8 = 42;
+  assertEqual((size_t) 0, parseInt("-", 1, i8));
+  assertEqual((size_t) 0, parseInt("+x", 2, i8));
+  assertEqual(42, i8);
+
+  assertEqual((size_t) 4, parseInt("-128", 4, i8));
+  assertEqual(-128, i8);
+  assertEqual((size_t) 4, parseInt("+127", 4, i8));
+  assertEqual(127, i8);
+  assertEqual((size_t) 0, parseInt("-129", 4, i8));
+  assertEqual((size_t) 0, parseInt("128", 3, i8));
+  assertEqual(127, i8);
+
+  int64_t i64;
+  assertEqual((size_t) 20, parseInt("-9223372036854775808", 20, i64));
+  assertTrue(i64 == INT64_MIN);
+  assertEqual((size_t) 19, parseInt("9223372036854775807", 19, i64));
+  assertTrue(i64 == INT64_MAX);
+  assertEqual((size_t) 0, parseInt("9223372036854775808", 19, i64));
+
+  // Unsigned types accept only "-0".
+  uint16_t u16;
+  assertEqual((size_t) 2, parseInt("-0", 2, u16));
+  assertEqual(0, u16);
+  assertEqual((size_t) 0, parseInt("-1", 2, u16));
+  assertEqual((size_t) 6, parseInt("+65535", 6, u16));
+  assertEqual(65535, u16);
+
+  int32_t i32;
+  assertEqual((size_t) 3, parseInt(F("-42 "), 4, i32));
+  assertEqual((int32_t) -42, i32);
+}
+
+//----------------------------------------------------------------------------
+// parseFixedPoint()
+//----------------------------------------------------------------------------
+
+test(ParseIntTest, parseFixedPoint) {
+  int32_t i32 = 42;
+  assertEqual((size_t) 0, parseFixedPoint<3>(".", 1, i32));
+  assertEqual((size_t) 0, parseFixedPoint<3>("-.", 2, i32));
+  assertEqual((int32_t) 42, i32);
+
+  assertEqual((size_t) 6, parseFixedPoint<3>("12.345", 6, i32));
+  assertEqual((int32_t) 12345, i32);
+  assertEqual((size_t) 5, parseFixedPoint<3>("-12.3", 5, i32));
+  assertEqual((int32_t) -12300, i32);
+  assertEqual((size_t) 2, parseFixedPoint<3>("12", 2, i32));
+  assertEqual((int32_t) 12000, i32);
+  assertEqual((size_t) 3, parseFixedPoint<3>("12.", 3, i32));
+  assertEqual((int32_t) 12000, i32);
+  assertEqual((size_t) 2, parseFixedPoint<3>(".5", 2, i32));
+  assertEqual((int32_t) 500, i32);
+
+  // Extra fractional digits are consumed and truncated.
+  assertEqual((size_t) 8, parseFixedPoint<3>("-12.3456C", 9, i32));
+  assertEqual((int32_t) -12345, i32);
+
+  // 0 decimals.
+  assertEqual((size_t) 4, parseFixedPoint<0>("12.9", 4, i32));
+  assertEqual((int32_t) 12, i32);
+
+  assertEqual((size_t) 7, parseFixedPoint<2>(F("+100.25"), 7, i32));
+  assertEqual((int32_t) 10025, i32);
+}
+
+test(ParseIntTest, parseFixedPoint_overflow) {
+  int16_t i16;
+  assertEqual((size_t) 6, parseFixedPoint<3>("32.767", 6, i16));
+  assertEqual(32767, i16);
+  assertEqual((size_t) 7, parseFixedPoint<3>("-32.768", 7, i16));
+  assertEqual(-32768, i16);
+  assertEqual((size_t) 0, parseFixedPoint<3>("32.768", 6, i16));
+  assertEqual((size_t) 0, parseFixedPoint<3>("33", 2, i16));
+  assertEqual(-32768, i16);
+
+  // 10^3 does not fit in uint8_t, so only a fraction is accepted.
+  uint8_t u8;
+  assertEqual((size_t) 4, parseFixedPoint<3>(".255", 4, u8));
+  assertEqual(255, u8);
+  assertEqual((size_t) 0, parseFixedPoint<3>("0.256", 5, u8));
+  assertEqual((size_t) 0, parseFixedPoint<3>("1", 1, u8));
+
+  uint64_t u64;
+  assertEqual((size_t) 21,
+      parseFixedPoint<19>("1.8446744073709551615", 21, u64));
+  assertEqual((uint64_t) 18446744073709551615ULL, u64);
+  assertEqual((size_t) 0,
+      parseFixedPoint<19>("1.8446744073709551616", 21, u64));
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,310 @@
+#line 2 "PrintFloatToTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+// Platforms where a double is the same as a float.
+#if defined(__SIZEOF_DOUBLE__) && __SIZEOF_DOUBLE__ == 4
+  #define DOUBLE_IS_FLOAT 1
+#else
+  #define DOUBLE_IS_FLOAT 0
+#endif
+
+//----------------------------------------------------------------------------
+// printFloatTo(float)
+//----------------------------------------------------------------------------
+
+test(PrintFloatToTest, float_shortest) {
+  PrintStr<32> printStr;
+
+  printStr.flush();
+  assertEqual((size_t) 1, printFloatTo(printStr, 0.0f));
+  assertEqual("0", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -0.0f);
+  assertEqual("0", printStr.cstr());
+
+  printStr.flush();
+  assertEqual((size_t) 3, printFloatTo(printStr, 0.1f));
+  assertEqual("0.1", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.0f);
+  assertEqual("1", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -123.25f);
+  assertEqual("-123.25", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 16777216.0f);
+  assertEqual("16777216", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 3.4028235e38f);
+  assertEqual("3.4028235e+38", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.0e-7f);
+  assertEqual("1e-7", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.0e-6f);
+  assertEqual("0.000001", printStr.cstr());
+
+  // smallest denormal
+  printStr.flush();
+  printFloatTo(printStr, 1.0e-45f);
+  assertEqual("1e-45", printStr.cstr());
+}
+
+test(PrintFloatToTest, float_nan_inf) {
+  PrintStr<32> printStr;
+
+  printStr.flush();
+  assertEqual((size_t) 3, printFloatTo(printStr, (float) NAN));
+  assertEqual("nan", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, (float) INFINITY);
+  assertEqual("inf", printStr.cstr());
+
+  printStr.flush();
+  assertEqual((size_t) 4, printFloatTo(printStr, (float) -INFINITY));
+  assertEqual("-inf", printStr.cstr());
+}
+
+test(PrintFloatToTest, float_precision) {
+  PrintStr<32> printStr;
+
+  printStr.flush();
+  printFloatTo(printStr, 0.1f, 2);
+  assertEqual("0.10", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.25f, 1);
+  assertEqual("1.2", printStr.cstr()); // exact tie, half to even
+
+  printStr.flush();
+  printFloatTo(printStr, 1.75f, 1);
+  assertEqual("1.8", printStr.cstr()); // exact tie, half to even
+
+  printStr.flush();
+  printFloatTo(printStr, 9.96f, 1);
+  assertEqual("10.0", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 0.5f, 0);
+  assertEqual("0", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.5f, 0);
+  assertEqual("2", printStr.cstr());
+
+  // 0.95f is 0.949999988079071044921875
+  printStr.flush();
+  printFloatTo(printStr, 0.95f, 1);
+  assertEqual("0.9", printStr.cstr());
+
+  // 0.15f is 0.1500000059604644775390625
+  printStr.flush();
+  printFloatTo(printStr, 0.15f, 1);
+  assertEqual("0.2", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -0.0f, 2);
+  assertEqual("0.00", printStr.cstr());
+
+  // 0.1f is 0.100000001490116119384765625
+  printStr.flush();
+  printFloatTo(printStr, 0.1f, 10);
+  assertEqual("0.1000000015", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 0.06f, 1);
+  assertEqual("0.1", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 0.004f, 2);
+  assertEqual("0.00", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -1.995f, 2);
+  assertEqual("-2.00", printStr.cstr());
+
+  printStr.flush();
+  assertEqual((size_t) 13, printFloatTo(printStr, 1.0e10f, 1));
+  assertEqual("10000000000.0", printStr.cstr());
+}
+
+//----------------------------------------------------------------------------
+// printFloatTo(double)
+//----------------------------------------------------------------------------
+
+#if ! DOUBLE_IS_FLOAT
+
+test(PrintFloatToTest, double_shortest) {
+  PrintStr<32> printStr;
+
+  printStr.flush();
+  printFloatTo(printStr, 0.1);
+  assertEqual("0.1", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 0.3);
+  assertEqual("0.3", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 0.1 + 0.2);
+  assertEqual("0.30000000000000004", printStr.cstr());
+
+  // a float promoted to double keeps all its binary digits
+  printStr.flush();
+  printFloatTo(printStr, (double) 0.1f);
+  assertEqual("0.10000000149011612", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1e21);
+  assertEqual("1e+21", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1e20);
+  assertEqual("100000000000000000000", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1e23);
+  assertEqual("1e+23", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1.7976931348623157e308);
+  assertEqual("1.7976931348623157e+308", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 2.2250738585072014e-308);
+  assertEqual("2.2250738585072014e-308", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 5e-324);
+  assertEqual("5e-324", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -9007199254740993.0);
+  assertEqual("-9007199254740992", printStr.cstr());
+}
+
+test(PrintFloatToTest, double_precision) {
+  PrintStr<64> printStr;
+
+  printStr.flush();
+  printFloatTo(printStr, 3.14159, 3);
+  assertEqual("3.142", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 2.5, 0);
+  assertEqual("2", printStr.cstr()); // exact tie, half to even
+
+  printStr.flush();
+  printFloatTo(printStr, 3.5, 0);
+  assertEqual("4", printStr.cstr()); // exact tie, half to even
+
+  // 9.995 is 9.9949999999999992184029906638897955417633056640625
+  printStr.flush();
+  printFloatTo(printStr, 9.995, 2);
+  assertEqual("9.99", printStr.cstr());
+
+  // 0.95 is 0.9499999999999999555910790149937383830547332763671875
+  printStr.flush();
+  printFloatTo(printStr, 0.95, 1);
+  assertEqual("0.9", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 0.125, 2);
+  assertEqual("0.12", printStr.cstr()); // exact tie, half to even
+
+  printStr.flush();
+  printFloatTo(printStr, 0.375, 2);
+  assertEqual("0.38", printStr.cstr()); // exact tie, half to even
+
+  // 1.005 is 1.00499999999999989341858963598497211933135986328125
+  printStr.flush();
+  printFloatTo(printStr, 1.005, 2);
+  assertEqual("1.00", printStr.cstr());
+
+  // 0.45 is 0.450000000000000011102230246251565404236316680908203125
+  printStr.flush();
+  printFloatTo(printStr, 0.45, 1);
+  assertEqual("0.5", printStr.cstr());
+
+  // Digits beyond the shortest representation come from the exact value.
+  printStr.flush();
+  printFloatTo(printStr, 0.1, 20);
+  assertEqual("0.10000000000000000555", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 933117981743121.75, 3);
+  assertEqual("933117981743121.750", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1152921504606846976.0, 0); // 2^60
+  assertEqual("1152921504606846976", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -0.001, 2);
+  assertEqual("-0.00", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -0.0, 1);
+  assertEqual("0.0", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, -0.0);
+  assertEqual("0", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1e-10, 4);
+  assertEqual("0.0000", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1e-10, 12);
+  assertEqual("0.000000000100", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 1e21, 1);
+  assertEqual("1000000000000000000000.0", printStr.cstr());
+
+  printStr.flush();
+  printFloatTo(printStr, 999.9999, 2);
+  assertEqual("1000.00", printStr.cstr());
+}
+
+#endif
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
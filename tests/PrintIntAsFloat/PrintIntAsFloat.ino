@@ -37,6 +37,10 @@ test(PrintUint16AsFloat3) {
   printStr.flush();
   printUint16AsFloat3To(printStr, 12345U);
   assertEqual("12.345", printStr.cstr());
+
+  printStr.flush();
+  printUint16AsFloat3To(printStr, 65535U);
+  assertEqual("65.535", printStr.cstr());
 }
 
 test(PrintUint32AsFloat3) {
@@ -81,6 +85,49 @@ test(PrintUint32AsFloat3) {
   printStr.flush();
   printUint32AsFloat3To(printStr, 123456789UL);
   assertEqual("123456.789", printStr.cstr());
+
+  printStr.flush();
+  printUint32AsFloat3To(printStr, 4294967295UL);
+  assertEqual("4294967.295", printStr.cstr());
+}
+
+test(PrintFixedPointTo) {
+  PrintStr<40> printStr;
+
+  printFixedPointTo<3>(printStr, -12345);
+  assertEqual("-12.345", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<3>(printStr, -5);
+  assertEqual("-0.005", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<1>(printStr, (uint8_t) 255);
+  assertEqual("25.5", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<4>(printStr, (uint8_t) 255);
+  assertEqual("0.0255", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<0>(printStr, (int16_t) -32768);
+  assertEqual("-32768", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<6>(printStr, (uint64_t) 18446744073709551615ULL);
+  assertEqual("18446744073709.551615", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<6>(printStr, (int64_t) -9223372036854775807LL - 1);
+  assertEqual("-9223372036854.775808", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<19>(printStr, (uint64_t) 18446744073709551615ULL);
+  assertEqual("1.8446744073709551615", printStr.cstr());
+
+  printStr.flush();
+  printFixedPointTo<12>(printStr, 1UL);
+  assertEqual("0.000000000001", printStr.cstr());
 }
 
 //----------------------------------------------------------------------------
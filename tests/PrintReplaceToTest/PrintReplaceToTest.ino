@@ -6,7 +6,11 @@
 using aunit::TestRunner;
 using ace_common::printReplaceCharTo;
 using ace_common::printReplaceStringTo;
+using ace_common::printReplaceCharsTo;
+using ace_common::printReplacePatternsTo;
 using ace_common::PrintStr;
+using ace_common::CharReplacer;
+using ace_common::PatternReplacer;
 
 //----------------------------------------------------------------------------
 // printReplaceCharTo(char*)
@@ -120,6 +124,227 @@ test(printReplaceStringTo_Flash, outOfBounds) {
   assertEqual("Es", printStr.cstr());
 }
 
+//---------------------------------------------------------------------------
+// Verify that unmodified runs are sent using a single Print::write().
+//---------------------------------------------------------------------------
+
+/** A PrintStr which counts the number of calls to write(). */
+class CountingPrintStr: public PrintStr<80> {
+  public:
+    size_t write(uint8_t c) override {
+      numWrites++;
+      return PrintStr<80>::write(c);
+    }
+
+    size_t write(const uint8_t *buf, size_t size) override {
+      numWrites++;
+      return PrintStr<80>::write(buf, size);
+    }
+
+    uint8_t numWrites = 0;
+};
+
+test(printReplaceCharTo, runs) {
+  CountingPrintStr printStr;
+  printReplaceCharTo(printStr, "abcdef%ghijkl%", '%', '-');
+  assertEqual("abcdef-ghijkl-", printStr.cstr());
+  assertEqual(4, printStr.numWrites);
+}
+
+test(printReplaceCharTo_Flash, runs) {
+  // The run before the first '%' is longer than the internal staging buffer.
+  // The staging buffer is not used if the f-string is a normal pointer.
+  CountingPrintStr printStr;
+  printReplaceCharTo(printStr, F("abcdefghijklmnopqrstuvwxyz%0123"), '%', '\0');
+  assertEqual("abcdefghijklmnopqrstuvwxyz0123", printStr.cstr());
+  assertEqual(ACE_COMMON_UNIFIED_FLASH ? 2 : 3, printStr.numWrites);
+}
+
+//---------------------------------------------------------------------------
+// printReplaceCharsTo()
+//---------------------------------------------------------------------------
+
+static const char* const HTML_ESCAPES[] = {
+  "&amp;", "&lt;", "&gt;", "&quot;", ""
+};
+
+static const char HTML_AMP[] PROGMEM = "&amp;";
+static const char HTML_LT[] PROGMEM = "&lt;";
+static const char HTML_GT[] PROGMEM = "&gt;";
+static const char HTML_QUOT[] PROGMEM = "&quot;";
+static const char HTML_EMPTY[] PROGMEM = "";
+
+static const __FlashStringHelper* const HTML_ESCAPES_F[] PROGMEM = {
+  (const __FlashStringHelper*) HTML_AMP,
+  (const __FlashStringHelper*) HTML_LT,
+  (const __FlashStringHelper*) HTML_GT,
+  (const __FlashStringHelper*) HTML_QUOT,
+  (const __FlashStringHelper*) HTML_EMPTY,
+};
+
+test(printReplaceCharsTo, contains) {
+  CharReplacer replacer("&<>\"\x80", HTML_ESCAPES);
+  assertTrue(replacer.contains('&'));
+  assertTrue(replacer.contains('"'));
+  assertTrue(replacer.contains('\x80'));
+  assertFalse(replacer.contains('a'));
+  assertFalse(replacer.contains('\0'));
+  assertFalse(replacer.contains('\xFF'));
+}
+
+test(printReplaceCharsTo, normal) {
+  CharReplacer replacer("&<>\"'", HTML_ESCAPES);
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplaceCharsTo(printStr, "NOREPLACE", replacer);
+  assertEqual("NOREPLACE", printStr.cstr());
+
+  printStr.flush();
+  printReplaceCharsTo(printStr, "<a href=\"x&y\">'", replacer);
+  assertEqual("&lt;a href=&quot;x&amp;y&quot;&gt;", printStr.cstr());
+}
+
+test(printReplaceCharsTo, flash) {
+  CharReplacer replacer("&<>\"'", HTML_ESCAPES_F);
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplaceCharsTo(printStr, F("<a href=\"x&y\">'"), replacer);
+  assertEqual("&lt;a href=&quot;x&amp;y&quot;&gt;", printStr.cstr());
+}
+
+test(printReplaceCharsTo, outOfBounds) {
+  CharReplacer replacer("&<>\"'", HTML_ESCAPES);
+  PrintStr<4> printStr;
+
+  printStr.flush();
+  printReplaceCharsTo(printStr, "a<b", replacer);
+  assertEqual("a&l", printStr.cstr());
+}
+
+//---------------------------------------------------------------------------
+// printReplacePatternsTo()
+//---------------------------------------------------------------------------
+
+static const char* const JSON_PATTERNS[] = {"\\", "\"", "\n", "</"};
+static const char* const JSON_REPLACEMENTS[] = {"\\\\", "\\\"", "\\n", "<\\/"};
+
+static const char JSON_P0[] PROGMEM = "\\";
+static const char JSON_P1[] PROGMEM = "\"";
+static const char JSON_P2[] PROGMEM = "\n";
+static const char JSON_P3[] PROGMEM = "</";
+static const char JSON_R0[] PROGMEM = "\\\\";
+static const char JSON_R1[] PROGMEM = "\\\"";
+static const char JSON_R2[] PROGMEM = "\\n";
+static const char JSON_R3[] PROGMEM = "<\\/";
+
+static const __FlashStringHelper* const JSON_PATTERNS_F[] PROGMEM = {
+  (const __FlashStringHelper*) JSON_P0,
+  (const __FlashStringHelper*) JSON_P1,
+  (const __FlashStringHelper*) JSON_P2,
+  (const __FlashStringHelper*) JSON_P3,
+};
+
+static const __FlashStringHelper* const JSON_REPLACEMENTS_F[] PROGMEM = {
+  (const __FlashStringHelper*) JSON_R0,
+  (const __FlashStringHelper*) JSON_R1,
+  (const __FlashStringHelper*) JSON_R2,
+  (const __FlashStringHelper*) JSON_R3,
+};
+
+test(printReplacePatternsTo, json) {
+  PatternReplacer<8> replacer(JSON_PATTERNS, JSON_REPLACEMENTS, 4);
+  assertTrue(replacer.isValid());
+  assertEqual(6, replacer.getNumNodes());
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "NOREPLACE", replacer);
+  assertEqual("NOREPLACE", printStr.cstr());
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "a\"b\\c\n<<</d<", replacer);
+  assertEqual("a\\\"b\\\\c\\n<<<\\/d<", printStr.cstr());
+}
+
+test(printReplacePatternsTo, json_flash) {
+  PatternReplacer<8> replacer(JSON_PATTERNS_F, JSON_REPLACEMENTS_F, 4);
+  assertTrue(replacer.isValid());
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, F("a\"b\\c\n<<</d<"), replacer);
+  assertEqual("a\\\"b\\\\c\\n<<<\\/d<", printStr.cstr());
+}
+
+test(printReplacePatternsTo, overlapping) {
+  // "he" is completed before "she", "hers" never completes before "he".
+  static const char* const PATTERNS[] = {"he", "she", "his", "hers"};
+  static const char* const REPLACEMENTS[] = {"1", "2", "3", "4"};
+  PatternReplacer<12> replacer(PATTERNS, REPLACEMENTS, 4);
+  assertTrue(replacer.isValid());
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "ushers", replacer);
+  assertEqual("u2rs", printStr.cstr());
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "this hers", replacer);
+  assertEqual("t3 1rs", printStr.cstr());
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "hhhis", replacer);
+  assertEqual("hh3", printStr.cstr());
+}
+
+test(printReplacePatternsTo, longestAtSameEnd) {
+  static const char* const PATTERNS[] = {"b", "abc", "bc"};
+  static const char* const REPLACEMENTS[] = {"1", "2", "3"};
+  PatternReplacer<8> replacer(PATTERNS, REPLACEMENTS, 3);
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "xbcx", replacer);
+  assertEqual("x1cx", printStr.cstr());
+
+  static const char* const PATTERNS2[] = {"c", "abc", "bc"};
+  PatternReplacer<8> replacer2(PATTERNS2, REPLACEMENTS, 3);
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "xabcx", replacer2);
+  assertEqual("x2x", printStr.cstr());
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "xbcx", replacer2);
+  assertEqual("x3x", printStr.cstr());
+}
+
+test(printReplacePatternsTo, emptyAndDuplicate) {
+  static const char* const PATTERNS[] = {"", "ab", "ab"};
+  static const char* const REPLACEMENTS[] = {"0", "1", "2"};
+  PatternReplacer<4> replacer(PATTERNS, REPLACEMENTS, 3);
+  assertTrue(replacer.isValid());
+  PrintStr<40> printStr;
+
+  printStr.flush();
+  printReplacePatternsTo(printStr, "xaby", replacer);
+  assertEqual("x1y", printStr.cstr());
+}
+
+test(printReplacePatternsTo, overflow) {
+  PatternReplacer<4> replacer(JSON_PATTERNS, JSON_REPLACEMENTS, 4);
+  assertFalse(replacer.isValid());
+  assertEqual(1, replacer.getNumNodes());
+  PrintStr<40> printStr;
+
+  // An invalid replacer replaces nothing.
+  printStr.flush();
+  printReplacePatternsTo(printStr, "a\"b", replacer);
+  assertEqual("a\"b", printStr.cstr());
+}
+
 // ---------------------------------------------------------------------------
 
 void setup() {
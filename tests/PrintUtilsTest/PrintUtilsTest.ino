@@ -29,6 +29,247 @@ test(PrintfToTest, printfTo) {
 
 //----------------------------------------------------------------------------
 
+test(PrintfToTest, printfToUnbounded) {
+  PrintStr<10> str;
+
+  assertEqual(2, printfToUnbounded(str, "%d", 10));
+  assertEqual("10", str.cstr());
+
+  str.flush();
+  printfToUnbounded(str, "%03d%s", 10, "ab");
+  assertEqual("010ab", str.cstr());
+
+  // Output is truncated by the PrintStr, but the full length is returned.
+  str.flush();
+  assertEqual(12, printfToUnbounded(str, "%s%s", "abcdef", "ghijkl"));
+  assertEqual("abcdefghi", str.cstr());
+}
+
+test(PrintfToTest, printfToUnbounded_long) {
+  // Longer than PRINTF_TO_BUF_SIZE, which would be truncated by printfTo().
+  PrintStr<300> str;
+  const char* s = "0123456789012345678901234567890123456789";
+  int n = printfToUnbounded(str, "%s%s%s%s%s%s|%d", s, s, s, s, s, s, 42);
+  assertEqual(243, n);
+  assertEqual((size_t) 243, str.length());
+  assertEqual('|', str.cstr()[240]);
+  assertEqual('2', str.cstr()[242]);
+}
+
+//----------------------------------------------------------------------------
+
+test(PrintFormatToTest, integers) {
+  PrintStr<40> str;
+
+  assertEqual((size_t) 2, printFormatTo(str, "%d", 10));
+  assertEqual("10", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%d %i %u", -10, (int8_t) -128, 40000U);
+  assertEqual("-10 -128 40000", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%ld %lu", -2147483647L - 1, 4294967295UL);
+  assertEqual("-2147483648 4294967295", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%x %X %o %b", 255, 0xABCDU, 8, (uint8_t) 5);
+  assertEqual("ff ABCD 10 101", str.cstr());
+
+  // Negative numbers in hex print the bit pattern of the original type.
+  str.flush();
+  printFormatTo(str, "%x %x", (int8_t) -1, (int16_t) -2);
+  assertEqual("ff fffe", str.cstr());
+
+  // Type-safe: the conversion does not need to match the type.
+  str.flush();
+  printFormatTo(str, "%u %d", -1, 7UL);
+  assertEqual("-1 7", str.cstr());
+}
+
+test(PrintFormatToTest, flagsWidthPrecision) {
+  PrintStr<40> str;
+
+  printFormatTo(str, "%03d|%5d|%-5d|", 10, -42, 7);
+  assertEqual("010|  -42|7    |", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%05d|%+d|% d|%.3d", -42, 5, 5, 7);
+  assertEqual("-0042|+5| 5|007", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%04X|%08b", 0xBEEF, 10);
+  assertEqual("BEEF|00001010", str.cstr());
+}
+
+test(PrintFormatToTest, largeWidthAndPrecision) {
+  // Widths and precisions above 255 are not truncated modulo 256.
+  PrintStr<400> str;
+  size_t n = printFormatTo(str, "%300d|", 42);
+  assertEqual((size_t) 301, n);
+  assertEqual((size_t) 301, str.length());
+  assertEqual('4', str.cstr()[298]);
+  assertEqual('|', str.cstr()[300]);
+
+  str.flush();
+  n = printFormatTo(str, "%.200d", 7);
+  assertEqual((size_t) 200, n);
+  assertEqual('0', str.cstr()[0]);
+  assertEqual('7', str.cstr()[199]);
+
+  str.flush();
+  n = printFormatTo(str, "%-256s|%.300s", "a", "bc");
+  assertEqual((size_t) 259, n);
+  assertEqual('|', str.cstr()[256]);
+
+  // The width saturates at 32767 instead of overflowing.
+  ace_common::internal::CountingPrint counter;
+  assertEqual((size_t) 32767, printFormatTo(counter, "%99999d", 1));
+  assertEqual((size_t) 32767, printFormatTo(counter, "%32767d", 1));
+  assertEqual((size_t) 32767, printFormatTo(counter, "%.99999d", 1));
+}
+
+test(PrintFormatToTest, charsAndStrings) {
+  PrintStr<40> str;
+
+  printFormatTo(str, "%c%c%s", 'a', 66, "cd");
+  assertEqual("aBcd", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "[%5s][%-5s][%.2s]", "ab", "cd", "efgh");
+  assertEqual("[   ab][cd   ][ef]", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "[%4s]%s", F("xy"), F("zz"));
+  assertEqual("[  xy]zz", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%d", 'a');
+  assertEqual("97", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%s", (const char*) nullptr);
+  assertEqual("(null)", str.cstr());
+}
+
+test(PrintFormatToTest, floats) {
+  PrintStr<40> str;
+
+  printFormatTo(str, "%.2f", 3.14159);
+  assertEqual("3.14", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "%f", 1.5f);
+  assertEqual("1.500000", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "[%7.2f][%-7.1f][%07.2f]", -1.25, 2.0, -3.5);
+  assertEqual("[  -1.25][2.0    ][-003.50]", str.cstr());
+}
+
+test(PrintFormatToTest, formatString) {
+  PrintStr<40> str;
+
+  assertEqual((size_t) 13, printFormatTo(str, "no arguments!"));
+  assertEqual("no arguments!", str.cstr());
+
+  str.flush();
+  printFormatTo(str, "100%% %d", 1);
+  assertEqual("100% 1", str.cstr());
+
+  // Missing arguments print nothing, extra arguments are ignored.
+  str.flush();
+  printFormatTo(str, "a%db%dc", 1);
+  assertEqual("a1bc", str.cstr());
+  str.flush();
+  printFormatTo(str, "a%d", 1, 2);
+  assertEqual("a1", str.cstr());
+
+  // Incomplete conversion at the end.
+  str.flush();
+  printFormatTo(str, "a%-3", 1);
+  assertEqual("a", str.cstr());
+
+  str.flush();
+  printFormatTo(str, F("flash %s=%04d"), "x", 12);
+  assertEqual("flash x=0012", str.cstr());
+}
+
+test(PrintFormatToTest, noTruncation) {
+  PrintStr<300> str;
+  const char* s = "0123456789012345678901234567890123456789";
+  size_t n = printFormatTo(str, "%s%s%s%s%s%s", s, s, s, s, s, s);
+  assertEqual((size_t) 240, n);
+  assertEqual((size_t) 240, str.length());
+}
+
+//----------------------------------------------------------------------------
+
+// Convert the digits between begin and end into a uint32_t.
+static uint32_t parseDigits(const char* begin, const char* end) {
+  uint32_t n = 0;
+  for (; begin < end; begin++) n = n * 10 + (*begin - '0');
+  return n;
+}
+
+test(FormatUintTest, udiv100) {
+  uint16_t n = 0;
+  do {
+    if (ace_common::internal::udiv100(n) != n / 100) {
+      assertEqual(n / 100, ace_common::internal::udiv100(n));
+    }
+  } while (++n != 0);
+}
+
+test(FormatUintTest, formatUint16) {
+  char buf[5];
+  char* end = buf + sizeof(buf);
+
+  char* begin = formatUint(end, (uint16_t) 0);
+  assertEqual(1, end - begin);
+  assertEqual('0', *begin);
+
+  begin = formatUint(end, (uint16_t) 65535);
+  assertEqual(5, end - begin);
+  assertEqual(0, strncmp("65535", begin, 5));
+
+  // Verify every value, including the number of digits.
+  uint16_t n = 0;
+  do {
+    begin = formatUint(end, n);
+    uint8_t numDigits = (n < 10) ? 1 : (n < 100) ? 2 : (n < 1000) ? 3
+        : (n < 10000) ? 4 : 5;
+    if (end - begin != numDigits || parseDigits(begin, end) != n) {
+      assertEqual((uint32_t) n, parseDigits(begin, end));
+      assertEqual(numDigits, end - begin);
+    }
+  } while (++n != 0);
+}
+
+test(FormatUintTest, formatUint32) {
+  char buf[10];
+  char* end = buf + sizeof(buf);
+
+  char* begin = formatUint(end, (uint32_t) 4294967295UL);
+  assertEqual(10, end - begin);
+  assertEqual(0, strncmp("4294967295", begin, 10));
+
+  begin = formatUint(end, (uint32_t) 65536UL);
+  assertEqual(5, end - begin);
+  assertEqual(0, strncmp("65536", begin, 5));
+
+  begin = formatUint(end, (uint32_t) 1000000UL);
+  assertEqual(7, end - begin);
+  assertEqual(0, strncmp("1000000", begin, 7));
+
+  for (uint32_t n = 1; n < 4000000000UL; n = n * 3 + 7) {
+    begin = formatUint(end, n);
+    assertEqual(n, parseDigits(begin, end));
+  }
+}
+
+//----------------------------------------------------------------------------
+
 test(PrintPadTest, printPad2To) {
   PrintStr<10> str;
 
@@ -97,6 +338,101 @@ test(PrintPadTest, printPad5To) {
   assertEqual("22222", str.cstr());
 }
 
+test(PrintPadTest, overflow) {
+  PrintStr<10> str;
+
+  // Values wider than the field are printed in full.
+  printPad2To(str, 123);
+  assertEqual("123", str.cstr());
+
+  str.flush();
+  printPad3To(str, 65535, '0');
+  assertEqual("65535", str.cstr());
+}
+
+test(PrintPadTest, printPadTo_unsigned) {
+  PrintStr<80> str;
+
+  printPadTo<2>(str, (uint8_t) 7);
+  assertEqual(" 7", str.cstr());
+
+  str.flush();
+  printPadTo<6>(str, (uint16_t) 65535, '0');
+  assertEqual("065535", str.cstr());
+
+  str.flush();
+  printPadTo<3>(str, 4294967295UL);
+  assertEqual("4294967295", str.cstr());
+
+  str.flush();
+  printPadTo<22>(str, (uint64_t) 18446744073709551615ULL, '0');
+  assertEqual("0018446744073709551615", str.cstr());
+
+  str.flush();
+  printPadTo<1>(str, (uint64_t) 100000000ULL);
+  assertEqual("100000000", str.cstr());
+
+  str.flush();
+  printPadTo<1>(str, (uint64_t) 12345678900000001ULL);
+  assertEqual("12345678900000001", str.cstr());
+}
+
+test(PrintPadTest, printPadTo_signed) {
+  PrintStr<80> str;
+
+  printPadTo<5>(str, -42);
+  assertEqual("  -42", str.cstr());
+
+  str.flush();
+  printPadTo<5>(str, -42, '0');
+  assertEqual("-0042", str.cstr());
+
+  str.flush();
+  printPadTo<4>(str, (int8_t) -128);
+  assertEqual("-128", str.cstr());
+
+  str.flush();
+  printPadTo<1>(str, (int16_t) -32768);
+  assertEqual("-32768", str.cstr());
+
+  str.flush();
+  printPadTo<1>(str, (int32_t) -2147483647L - 1);
+  assertEqual("-2147483648", str.cstr());
+
+  str.flush();
+  printPadTo<1>(str, (int64_t) -9223372036854775807LL - 1);
+  assertEqual("-9223372036854775808", str.cstr());
+
+  str.flush();
+  printPadTo<3>(str, 0L);
+  assertEqual("  0", str.cstr());
+}
+
+test(PrintPadTest, printPadTo_bases) {
+  PrintStr<80> str;
+
+  printPadTo<4, 16>(str, (uint8_t) 0x2A, '0');
+  assertEqual("002A", str.cstr());
+
+  str.flush();
+  printPadTo<8, 2>(str, 5, '0');
+  assertEqual("00000101", str.cstr());
+
+  str.flush();
+  printPadTo<1, 8>(str, 64U);
+  assertEqual("100", str.cstr());
+
+  str.flush();
+  printPadTo<1, 2>(str, (uint64_t) 0xFFFFFFFFFFFFFFFFULL);
+  assertEqual(
+      "1111111111111111111111111111111111111111111111111111111111111111",
+      str.cstr());
+
+  str.flush();
+  printPadTo<6, 16>(str, -255);
+  assertEqual("   -FF", str.cstr());
+}
+
 //----------------------------------------------------------------------------
 // setup() and loop()
 //----------------------------------------------------------------------------
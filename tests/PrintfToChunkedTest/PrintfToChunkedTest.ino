@@ -0,0 +1,154 @@
+#line 2 "PrintfToChunkedTest.ino"
+
+/*
+ * Compiled with -DACE_COMMON_PRINTF_TO_STREAM=0 by the Makefile, so that
+ * printfToUnbounded() formats each conversion separately, as it does on the
+ * platforms without a custom stdio stream.
+ */
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+#if ACE_COMMON_PRINTF_TO_STREAM != 0
+  #error This test must be compiled with -DACE_COMMON_PRINTF_TO_STREAM=0
+#endif
+
+//----------------------------------------------------------------------------
+
+test(PrintfToChunkedTest, text) {
+  PrintStr<20> str;
+
+  assertEqual(0, printfToUnbounded(str, ""));
+  assertEqual("", str.cstr());
+
+  str.flush();
+  assertEqual(6, printfToUnbounded(str, "a%%b %%c"));
+  assertEqual("a%b %c", str.cstr());
+}
+
+test(PrintfToChunkedTest, integers) {
+  PrintStr<80> str;
+
+  assertEqual(14, printfToUnbounded(str, "%d %i %u", -10, -128, 40000U));
+  assertEqual("-10 -128 40000", str.cstr());
+
+  str.flush();
+  printfToUnbounded(str, "%x %X %o %c", 255, 255, 8, 'z');
+  assertEqual("ff FF 10 z", str.cstr());
+
+  str.flush();
+  printfToUnbounded(str, "%ld %lu %lld %llu %zu %hhd %hd",
+      -100000L, 4000000000UL, -10000000000LL, 20000000000ULL, (size_t) 12,
+      (signed char) -5, (short) -300);
+  assertEqual("-100000 4000000000 -10000000000 20000000000 12 -5 -300",
+      str.cstr());
+}
+
+test(PrintfToChunkedTest, flagsWidthPrecision) {
+  PrintStr<80> str;
+
+  printfToUnbounded(str, "[%5d][%-5d][%05d][%+d][% d][%#x]",
+      42, 42, 42, 42, 42, 255);
+  assertEqual("[   42][42   ][00042][+42][ 42][0xff]", str.cstr());
+
+  str.flush();
+  printfToUnbounded(str, "[%*d][%*d][%.*f][%.*f]", 4, 7, -4, 7, 2, 1.5, -1,
+      1.5);
+  assertEqual("[   7][7   ][1.50][1.500000]", str.cstr());
+
+  str.flush();
+  printfToUnbounded(str, "[%5s][%-5s][%.2s][%*.*s]", "ab", "ab", "abc", 4, 1,
+      "xyz");
+  assertEqual("[   ab][ab   ][ab][   x]", str.cstr());
+}
+
+test(PrintfToChunkedTest, floats) {
+  PrintStr<40> str;
+
+  printfToUnbounded(str, "%.3f %e %g", 1.25, 1000.0, 0.5);
+  assertEqual("1.250 1.000000e+03 0.5", str.cstr());
+}
+
+test(PrintfToChunkedTest, longString) {
+  // A "%s" is not limited by PRINTF_TO_CHUNK_SIZE.
+  PrintStr<300> str;
+  const char* s = "0123456789012345678901234567890123456789";
+  int n = printfToUnbounded(str, "%s%s%s%s%s%s|%d", s, s, s, s, s, s, 42);
+  assertEqual(243, n);
+  assertEqual((size_t) 243, str.length());
+  assertEqual('|', str.cstr()[240]);
+  assertEqual('2', str.cstr()[242]);
+
+  str.flush();
+  n = printfToUnbounded(str, "%50s|", "ab");
+  assertEqual(51, n);
+  assertEqual('a', str.cstr()[48]);
+  assertEqual('|', str.cstr()[50]);
+}
+
+// Return true if printfToUnbounded() prints the same as snprintf().
+static bool matchesSnprintf(const char* fmt, ...) {
+  char expected[400];
+  va_list args;
+  va_start(args, fmt);
+  int expectedLength = vsnprintf(expected, sizeof(expected), fmt, args);
+  va_end(args);
+
+  PrintStr<400> str;
+  va_start(args, fmt);
+  int n = vprintfToUnbounded(str, fmt, args);
+  va_end(args);
+  return n == expectedLength && strcmp(expected, str.cstr()) == 0;
+}
+
+test(PrintfToChunkedTest, wideConversions) {
+  // Conversions longer than PRINTF_TO_CHUNK_SIZE - 1 are not truncated.
+  PrintStr<80> str;
+  int n = printfToUnbounded(str, "%40d|", 1);
+  assertEqual(41, n);
+  assertEqual((size_t) 41, str.length());
+  assertEqual('1', str.cstr()[39]);
+  assertEqual('|', str.cstr()[40]);
+
+  assertTrue(matchesSnprintf("[%40d][%-40d][%040d]", -12, -12, -12));
+  assertTrue(matchesSnprintf("[%+040d][% 040d][%#040x][%#40o]",
+      12, 12, 255, 8));
+  assertTrue(matchesSnprintf("[%040.5d][%-50c][%50c]", 12, 'a', 'b'));
+  assertTrue(matchesSnprintf("[%*lld][%-*zu]",
+      45, -1234567890123LL, -45, (size_t) 99));
+  assertTrue(matchesSnprintf("[%.20f][%.40f][%060.10f]", 1.5, 0.1, -3.25));
+  assertTrue(matchesSnprintf("[%f][%.3e][%-40g]", 1e300, 1e300, 2.5));
+  assertTrue(matchesSnprintf("[%040f][%-40f][%40a][%040a]",
+      1.0 / 0.0, -1.0 / 0.0, 1.5, -1.5));
+  assertTrue(matchesSnprintf("[%.50d][%50p]", 7, (void*) 0x1234));
+}
+
+test(PrintfToChunkedTest, invalid) {
+  PrintStr<20> str;
+  assertLess(printfToUnbounded(str, "abc%"), 0);
+  assertEqual("abc", str.cstr());
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
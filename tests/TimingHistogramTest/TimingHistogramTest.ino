@@ -0,0 +1,220 @@
+#line 2 "TimingHistogramTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using aunit::TestRunner;
+using ace_common::TimingHistogram;
+using ace_common::PrintStr;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+typedef TimingHistogram<3, 16> Histogram;
+
+//----------------------------------------------------------------------------
+// Buckets
+//----------------------------------------------------------------------------
+
+test(TimingHistogramTest, numBuckets) {
+  assertEqual(112, (int) Histogram::kNumBuckets);
+  typedef TimingHistogram<4, 20> LargeHistogram;
+  assertEqual(272, (int) LargeHistogram::kNumBuckets);
+}
+
+test(TimingHistogramTest, bucketIndex) {
+  // Linear below 2^SubBucketBits, and for the first power of 2.
+  assertEqual(0, Histogram::bucketIndex(0));
+  assertEqual(7, Histogram::bucketIndex(7));
+  assertEqual(8, Histogram::bucketIndex(8));
+  assertEqual(15, Histogram::bucketIndex(15));
+
+  // 16-31 are in buckets of 2.
+  assertEqual(16, Histogram::bucketIndex(16));
+  assertEqual(16, Histogram::bucketIndex(17));
+  assertEqual(23, Histogram::bucketIndex(31));
+
+  // 32-63 are in buckets of 4.
+  assertEqual(24, Histogram::bucketIndex(32));
+  assertEqual(24, Histogram::bucketIndex(35));
+  assertEqual(25, Histogram::bucketIndex(36));
+
+  // Largest value, and values too large for the histogram.
+  assertEqual(111, Histogram::bucketIndex(65535));
+  assertEqual(111, Histogram::bucketIndex(65536));
+  assertEqual(111, Histogram::bucketIndex(UINT32_MAX));
+}
+
+test(TimingHistogramTest, bucketUpperBound) {
+  assertEqual((uint32_t) 0, Histogram::bucketUpperBound(0));
+  assertEqual((uint32_t) 15, Histogram::bucketUpperBound(15));
+  assertEqual((uint32_t) 17, Histogram::bucketUpperBound(16));
+  assertEqual((uint32_t) 35, Histogram::bucketUpperBound(24));
+  assertEqual((uint32_t) 65535, Histogram::bucketUpperBound(111));
+
+  // Every value is inside its own bucket.
+  for (uint32_t v = 0; v < 65536; v += 7) {
+    uint16_t i = Histogram::bucketIndex(v);
+    assertLessOrEqual(v, Histogram::bucketUpperBound(i));
+    if (i > 0) {
+      assertMore(v, Histogram::bucketUpperBound(i - 1));
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Statistics
+//----------------------------------------------------------------------------
+
+test(TimingHistogramTest, empty) {
+  Histogram histogram;
+  assertEqual((uint32_t) 0, histogram.getCount());
+  assertEqual((uint32_t) 0, histogram.getMin());
+  assertEqual((uint32_t) 0, histogram.getMax());
+  assertEqual((uint32_t) 0, histogram.getPercentile(50));
+}
+
+test(TimingHistogramTest, percentiles) {
+  Histogram histogram;
+  for (uint32_t i = 1; i <= 100; i++) {
+    histogram.update(i);
+  }
+
+  assertEqual((uint32_t) 100, histogram.getCount());
+  assertEqual((uint32_t) 1, histogram.getMin());
+  assertEqual((uint32_t) 100, histogram.getMax());
+  assertEqual((uint32_t) 50, histogram.getAvg());
+  assertEqual((uint32_t) 1, histogram.getPercentile(0));
+  assertEqual((uint32_t) 100, histogram.getPercentile(100));
+
+  // 50 is in the bucket [48, 51], 95 in [88, 95], 99 in [96, 103].
+  assertEqual((uint32_t) 51, histogram.getPercentile(50));
+  assertEqual((uint32_t) 95, histogram.getPercentile(95));
+  assertEqual((uint32_t) 100, histogram.getPercentile(99));
+}
+
+test(TimingHistogramTest, tail) {
+  Histogram histogram;
+  for (uint8_t i = 0; i < 98; i++) {
+    histogram.update(10);
+  }
+  histogram.update(1000);
+  histogram.update(5000);
+
+  assertEqual((uint32_t) 10, histogram.getPercentile(50));
+  assertEqual((uint32_t) 10, histogram.getPercentile(98));
+  assertEqual((uint32_t) 1023, histogram.getPercentile(99));
+  assertEqual((uint32_t) 5000, histogram.getPercentile(100));
+}
+
+test(TimingHistogramTest, overflow) {
+  // Values of 2^16 or larger are counted in the last bucket, whose upper
+  // bound (65535) would understate them.
+  Histogram histogram;
+  for (uint8_t i = 0; i < 98; i++) {
+    histogram.update(10);
+  }
+  histogram.update(100000);
+  histogram.update(200000);
+
+  assertEqual(Histogram::kNumBuckets - 1, Histogram::bucketIndex(100000));
+  assertEqual((uint32_t) 10, histogram.getPercentile(98));
+  assertEqual((uint32_t) 200000, histogram.getPercentile(99));
+  assertEqual((uint32_t) 200000, histogram.getPercentile(100));
+}
+
+test(TimingHistogramTest, merge) {
+  Histogram a;
+  Histogram b;
+  a.update(10);
+  a.update(20);
+  b.update(5);
+  b.update(30);
+
+  a.merge(b);
+  assertEqual((uint32_t) 4, a.getCount());
+  assertEqual((uint32_t) 5, a.getMin());
+  assertEqual((uint32_t) 30, a.getMax());
+  assertEqual((uint32_t) 16, a.getAvg());
+  assertEqual((uint32_t) 10, a.getPercentile(50));
+
+  // Merging into an empty histogram copies the min and max.
+  Histogram c;
+  c.merge(b);
+  assertEqual((uint32_t) 2, c.getCount());
+  assertEqual((uint32_t) 5, c.getMin());
+  assertEqual((uint32_t) 30, c.getMax());
+
+  // Merging an empty histogram changes nothing.
+  Histogram d;
+  c.merge(d);
+  assertEqual((uint32_t) 2, c.getCount());
+}
+
+test(TimingHistogramTest, saturation) {
+  // Use 8-bit counters to reach the limit quickly.
+  TimingHistogram<3, 16, uint8_t> a;
+  for (uint16_t i = 0; i < 300; i++) {
+    a.update(10);
+  }
+  assertEqual(255, a.getBucketCount(10));
+  assertEqual((uint32_t) 300, a.getCount());
+  assertEqual((uint32_t) 10, a.getPercentile(50));
+
+  TimingHistogram<3, 16, uint8_t> b;
+  for (uint8_t i = 0; i < 200; i++) {
+    b.update(10);
+    b.update(20);
+  }
+  assertEqual(200, b.getBucketCount(10));
+
+  // Merging saturates the sum of the counts.
+  a.merge(b);
+  assertEqual(255, a.getBucketCount(10));
+  assertEqual(200, a.getBucketCount(Histogram::bucketIndex(20)));
+  assertEqual((uint32_t) 700, a.getCount());
+}
+
+test(TimingHistogramTest, reset) {
+  Histogram histogram;
+  histogram.update(10);
+  histogram.reset();
+  assertEqual((uint32_t) 0, histogram.getCount());
+  assertEqual(0, histogram.getBucketCount(10));
+  histogram.update(20);
+  assertEqual((uint32_t) 20, histogram.getMin());
+}
+
+test(TimingHistogramTest, printTo) {
+  Histogram histogram;
+  histogram.update(10);
+  histogram.update(20);
+  histogram.update(40);
+
+  PrintStr<64> printStr;
+  histogram.printTo(printStr);
+  assertEqual("count=3 min=10 avg=23 p50=21 p95=40 p99=40 max=40", printStr.cstr());
+}
+
+//----------------------------------------------------------------------------
+// setup() and loop()
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}
@@ -0,0 +1,188 @@
+#line 2 "TimingProbesTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using aunit::TestRunner;
+using ace_common::CycleClock;
+using ace_common::PrintStr;
+using ace_common::ScopedTimer;
+using ace_common::ScopedTimerT;
+using ace_common::TimingProbes;
+using ace_common::TimingStats;
+using ace_common::TimingStatsT;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+typedef TimingStatsT<uint32_t, uint64_t> MicrosStats;
+
+class FakeClock {
+  public:
+    static uint32_t now() { return sTicks; }
+
+    static uint32_t sTicks;
+};
+
+uint32_t FakeClock::sTicks = 0;
+
+//----------------------------------------------------------------------------
+// Test ScopedTimer
+//----------------------------------------------------------------------------
+
+test(ScopedTimerTest, updates_on_destruction) {
+  MicrosStats stats;
+  {
+    ScopedTimerT<MicrosStats> timer(stats);
+    delayMicroseconds(1000);
+    assertMoreOrEqual(timer.getElapsed(), (uint32_t) 1000);
+    assertEqual((uint32_t) 0, stats.getCount());
+  }
+  assertEqual((uint32_t) 1, stats.getCount());
+  assertMoreOrEqual(stats.getMin(), (uint32_t) 1000);
+}
+
+test(ScopedTimerTest, timing_stats) {
+  TimingStats stats;
+  for (uint8_t i = 0; i < 3; i++) {
+    ScopedTimer timer(stats);
+  }
+  assertEqual((uint32_t) 3, stats.getCount());
+}
+
+test(ScopedTimerTest, saturates_timing_stats) {
+  TimingStats stats;
+  {
+    ScopedTimerT<TimingStats, FakeClock> timer(stats);
+    FakeClock::sTicks += 70000;
+  }
+  {
+    ScopedTimerT<TimingStats, FakeClock> timer(stats);
+    FakeClock::sTicks += 100;
+  }
+  // 70000 is not truncated to 4464.
+  assertEqual((uint16_t) 65535, stats.getMax());
+  assertEqual((uint16_t) 100, stats.getMin());
+
+  MicrosStats micros;
+  {
+    ScopedTimerT<MicrosStats, FakeClock> timer(micros);
+    FakeClock::sTicks += 70000;
+  }
+  assertEqual((uint32_t) 70000, micros.getMax());
+}
+
+test(ScopedTimerTest, cycle_clock) {
+  CycleClock::begin();
+  MicrosStats stats;
+  {
+    ScopedTimerT<MicrosStats, CycleClock> timer(stats);
+    delayMicroseconds(100);
+  }
+  assertEqual((uint32_t) 1, stats.getCount());
+  // delayMicroseconds() can be 1 micro short
+  assertMoreOrEqual(
+      CycleClock::toMicros(stats.getMax()), (uint32_t) 99);
+  assertMoreOrEqual(
+      CycleClock::toNanos(stats.getMax()), (uint32_t) 99000);
+}
+
+//----------------------------------------------------------------------------
+// Test TimingProbes
+//----------------------------------------------------------------------------
+
+test(TimingProbesTest, probe_registers_once) {
+  TimingProbes<2> probes;
+  assertEqual(0, probes.size());
+
+  TimingStats& a = probes.probe(F("alpha"));
+  a.update(10);
+  assertEqual(1, probes.size());
+
+  // Same name from a different F() is the same probe.
+  TimingStats& a2 = probes.probe(F("alpha"));
+  assertTrue(&a == &a2);
+  a2.update(20);
+  assertEqual(1, probes.size());
+  assertEqual((uint32_t) 2, probes.getStats(0).getCount());
+  assertEqual(F("alpha"), probes.getName(0));
+}
+
+test(TimingProbesTest, overflow) {
+  TimingProbes<2> probes;
+  probes.probe(F("a"));
+  probes.probe(F("b"));
+  assertFalse(probes.isOverflow());
+  TimingStats& c = probes.probe(F("c"));
+  c.update(1);
+  assertTrue(probes.isOverflow());
+  assertEqual(2, probes.size());
+  assertEqual((uint32_t) 0, probes.getStats(0).getCount());
+  assertEqual((uint32_t) 0, probes.getStats(1).getCount());
+}
+
+test(TimingProbesTest, reset) {
+  TimingProbes<2> probes;
+  probes.probe(F("a")).update(3);
+  probes.reset();
+  assertEqual(1, probes.size());
+  assertEqual((uint32_t) 0, probes.getStats(0).getCount());
+}
+
+test(TimingProbesTest, printTo) {
+  TimingProbes<4> probes;
+  TimingStats& sensor = probes.probe(F("readSensor"));
+  sensor.update(352);
+  sensor.update(401);
+  sensor.update(327);
+  probes.probe(F("io")).update(7);
+
+  PrintStr<200> printStr;
+  probes.printTo(printStr);
+  assertEqual(
+      "name        count    min    avg    max\r\n"
+      "readSensor      3    327    360    401\r\n"
+      "io              1      7      7      7\r\n",
+      printStr.cstr());
+}
+
+#define NAME_50 "01234567890123456789012345678901234567890123456789"
+#define NAME_300 NAME_50 NAME_50 NAME_50 NAME_50 NAME_50 NAME_50
+
+test(TimingProbesTest, printTo_longName) {
+  TimingProbes<2> probes;
+  probes.probe(F(NAME_300)).update(5);
+  probes.probe(F("io")).update(7);
+
+  // The width of the name column is capped at 255, so the 300-character name
+  // is printed without padding, instead of an almost infinite padding.
+  PrintStr<1000> printStr;
+  probes.printTo(printStr);
+  const char* lines = printStr.cstr();
+  const char* line2 = strchr(lines, '\n') + 1;
+  assertEqual(0, strncmp(line2, NAME_300 "      1", 300 + 7));
+  const char* line3 = strchr(line2, '\n') + 1;
+  assertEqual(0, strncmp(line3, "io", 2));
+  assertEqual((size_t) 255 + 30, strlen(line3));
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}
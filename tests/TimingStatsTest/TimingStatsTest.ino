@@ -5,6 +5,7 @@
 
 using aunit::TestRunner;
 using ace_common::TimingStats;
+using ace_common::TimingStatsT;
 
 //----------------------------------------------------------------------------
 // Test TimingStats
@@ -91,6 +92,73 @@ test(TimingStatsTest, reset) {
   assertEqual((uint16_t) 4, stats.getCounter());
 }
 
+//----------------------------------------------------------------------------
+// Test TimingStatsT
+//----------------------------------------------------------------------------
+
+test(TimingStatsTest, micros32_doNotOverflow) {
+  TimingStatsT<uint32_t, uint64_t> stats;
+  assertEqual(UINT32_MAX, stats.getMin());
+
+  // Durations longer than 65 ms in micros.
+  stats.update(100000);
+  stats.update(4000000000UL);
+  stats.update(4000000001UL);
+
+  assertEqual((uint32_t) 3, stats.getCount());
+  assertEqual((uint32_t) 100000, stats.getMin());
+  assertEqual((uint32_t) 4000000001UL, stats.getMax());
+  assertEqual((uint64_t) 8000100001ULL, stats.getSum());
+  assertEqual((uint32_t) 2666700000UL, stats.getAvg());
+  assertEqual((uint32_t) 3000025000UL, stats.getExpDecayAvg());
+}
+
+test(TimingStatsTest, count32_doesNotOverflow) {
+  TimingStatsT<uint16_t, uint32_t> stats;
+  for (uint32_t i = 0; i < 70000; i++) {
+    stats.update((i & 1) ? 30 : 10);
+  }
+
+  assertEqual((uint32_t) 70000, stats.getCount());
+  assertEqual((uint32_t) 70000, stats.getCounter());
+  assertEqual((uint16_t) 20, stats.getAvg());
+}
+
+test(TimingStatsTest, merge) {
+  TimingStatsT<uint16_t, uint32_t> a;
+  TimingStatsT<uint16_t, uint32_t> b;
+  a.update(10);
+  a.update(20);
+  b.update(5);
+  b.update(40);
+
+  a.merge(b);
+  assertEqual((uint32_t) 4, a.getCount());
+  assertEqual((uint32_t) 4, a.getCounter());
+  assertEqual((uint16_t) 5, a.getMin());
+  assertEqual((uint16_t) 40, a.getMax());
+  assertEqual((uint32_t) 75, a.getSum());
+  assertEqual((uint16_t) 18, a.getAvg());
+  // (15 + 22) / 2, rounded down
+  assertEqual((uint16_t) 18, a.getExpDecayAvg());
+
+  // Merging into an empty object copies everything.
+  TimingStatsT<uint16_t, uint32_t> c;
+  c.merge(b);
+  assertEqual((uint32_t) 2, c.getCount());
+  assertEqual((uint16_t) 5, c.getMin());
+  assertEqual((uint16_t) 22, c.getExpDecayAvg());
+
+  // Merging an empty object adds only its counter.
+  TimingStatsT<uint16_t, uint32_t> d;
+  d.update(1);
+  d.reset();
+  c.merge(d);
+  assertEqual((uint32_t) 2, c.getCount());
+  assertEqual((uint32_t) 3, c.getCounter());
+  assertEqual((uint16_t) 5, c.getMin());
+}
+
 //----------------------------------------------------------------------------
 // setup() and loop()
 //----------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+#line 2 "UnifiedFlashTest.ino"
+
+/*
+ * Compiled with -DACE_COMMON_UNIFIED_FLASH=1 by the Makefile, so that the
+ * functions which take a `const __FlashStringHelper*` forward to their
+ * `const char*` versions, as they do on the ESP32, SAMD, STM32, RP2040 and
+ * Teensy ARM. The other tests cover the flash string code paths of the AVR and
+ * ESP8266, which is the default on EpoxyDuino.
+ */
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using namespace aunit;
+using namespace ace_common;
+
+#if ! ACE_COMMON_UNIFIED_FLASH
+  #error This test must be compiled with -DACE_COMMON_UNIFIED_FLASH=1
+#endif
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+class CountingPrintStr: public PrintStr<80> {
+  public:
+    size_t write(uint8_t c) override {
+      numWrites++;
+      return PrintStr<80>::write(c);
+    }
+
+    size_t write(const uint8_t *buf, size_t size) override {
+      numWrites++;
+      return PrintStr<80>::write(buf, size);
+    }
+
+    uint8_t numWrites = 0;
+};
+
+//----------------------------------------------------------------------------
+// FlashStringReader and pstrings
+//----------------------------------------------------------------------------
+
+test(UnifiedFlashTest, flashStringReader) {
+#if ACE_COMMON_FLASH_READER_BLOCK_SIZE == 0
+  // The f-string is a normal pointer, and its reader is that pointer.
+  const __FlashStringHelper* fs = F("the string");
+  const char* s = FlashStringReader(fs);
+  assertEqual((const char*) fs, s);
+  assertEqual('t', *s);
+#endif
+}
+
+test(UnifiedFlashTest, pstrings) {
+  assertEqual(0, strcmp_PP(PSTR("abc"), PSTR("abc")));
+  assertLess(strcmp_PP(PSTR("abc"), PSTR("abd")), 0);
+  assertMore(strcmp_PP(PSTR("abc"), nullptr), 0);
+  assertEqual(0, strcmp_PP(nullptr, nullptr));
+
+  const char* s = PSTR("abcabc");
+  assertEqual(s + 1, strchr_P(s, 'b'));
+  assertEqual(s + 4, strrchr_P(s, 'b'));
+  assertEqual((const char*) nullptr, strchr_P(s, 'z'));
+}
+
+test(UnifiedFlashTest, tstrings) {
+  assertEqual((size_t) 3, strlen_T(F("abc")));
+  assertEqual(0, strcmp_T("abc", F("abc")));
+  assertLess(strcmp_T("abc", F("abd")), 0);
+
+  char dst[8];
+  strcpy_T(dst, F("ab"));
+  strcat_T(dst, F("cd"));
+  assertEqual("abcd", dst);
+}
+
+//----------------------------------------------------------------------------
+// Functions which forward the f-string to the c-string version
+//----------------------------------------------------------------------------
+
+test(UnifiedFlashTest, hashAndCopyReplace) {
+  assertEqual(hashDjb2("hello"), hashDjb2(F("hello")));
+
+  char dst[16];
+  copyReplaceString(dst, sizeof(dst), F("E%T"), '%', "suv");
+  assertEqual("EsuvT", dst);
+  copyReplaceChar(dst, sizeof(dst), F("a-b-c"), '-', '_');
+  assertEqual("a_b_c", dst);
+}
+
+test(UnifiedFlashTest, printReplaceCharTo) {
+  // The f-string is printed directly, without the staging buffer.
+  CountingPrintStr printStr;
+  printReplaceCharTo(printStr, F("abcdefghijklmnopqrstuvwxyz%0123"), '%', '\0');
+  assertEqual("abcdefghijklmnopqrstuvwxyz0123", printStr.cstr());
+  assertEqual(2, printStr.numWrites);
+}
+
+test(UnifiedFlashTest, printFormatTo) {
+  PrintStr<32> printStr;
+  printFormatTo(printStr, F("flash %s=%04d"), F("x"), 12);
+  assertEqual("flash x=0012", printStr.cstr());
+}
+
+test(UnifiedFlashTest, parseUint) {
+  uint32_t u32;
+  assertEqual((size_t) 3, parseUint(F("123456789"), 3, u32));
+  assertEqual((uint32_t) 123, u32);
+}
+
+//----------------------------------------------------------------------------
+// Classes which no longer check the type of their strings
+//----------------------------------------------------------------------------
+
+test(UnifiedFlashTest, fcstring) {
+  FCString a(F("abcdefgh"));
+  FCString b("abcdefgi");
+  assertLess(a.compareTo(b), 0);
+  assertEqual(0, a.compareTo(FCString("abcdefgh")));
+
+  PrintStr<16> printStr;
+  a.printTo(printStr);
+  assertEqual("abcdefgh", printStr.cstr());
+}
+
+test(UnifiedFlashTest, kstring) {
+  static const char* const KEYWORDS[] = {nullptr, "America/"};
+  KString fs(F("\x01" "Denver"), KEYWORDS, 2);
+  assertEqual(0, fs.compareTo("America/Denver"));
+
+  KString ss("America/Denver", KEYWORDS, 2);
+  assertEqual(0, fs.compareTo(ss));
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}
@@ -0,0 +1,195 @@
+#line 2 "WindowedStatsTest.ino"
+
+#include <AUnit.h>
+#include <AceCommon.h>
+
+using aunit::TestRunner;
+using ace_common::WindowedStats;
+
+// ESP32 does not define SERIAL_PORT_MONITOR
+#ifndef SERIAL_PORT_MONITOR
+  #define SERIAL_PORT_MONITOR Serial
+#endif
+
+typedef WindowedStats<uint16_t, 3, uint32_t> Stats;
+
+//----------------------------------------------------------------------------
+// Test WindowedStats
+//----------------------------------------------------------------------------
+
+test(WindowedStatsTest, empty) {
+  Stats stats;
+  assertEqual((uint32_t) 0, stats.getCount());
+  assertEqual((uint16_t) 0, stats.getMin());
+  assertEqual((uint16_t) 0, stats.getMax());
+  assertEqual((uint16_t) 0, stats.getAvg());
+}
+
+test(WindowedStatsTest, single_interval) {
+  Stats stats;
+  stats.update(10);
+  stats.update(30);
+  stats.update(20);
+  assertEqual((uint32_t) 3, stats.getCount());
+  assertEqual((uint32_t) 60, stats.getSum());
+  assertEqual((uint16_t) 10, stats.getMin());
+  assertEqual((uint16_t) 30, stats.getMax());
+  assertEqual((uint16_t) 20, stats.getAvg());
+  assertEqual((uint16_t) 3, stats.getCurrent().getCount());
+}
+
+test(WindowedStatsTest, advance_expires_oldest) {
+  Stats stats;
+  stats.update(100); // interval 0
+  stats.update(5);
+  stats.advance();
+  stats.update(50); // interval 1
+  stats.advance();
+  stats.update(20); // interval 2
+  assertEqual((uint32_t) 4, stats.getCount());
+  assertEqual((uint16_t) 5, stats.getMin());
+  assertEqual((uint16_t) 100, stats.getMax());
+  assertEqual((uint16_t) 2, stats.getBucket(2).getCount());
+  assertEqual((uint16_t) 50, stats.getBucket(1).getMax());
+
+  // Interval 0 drops out of the window.
+  stats.advance();
+  assertEqual((uint32_t) 2, stats.getCount());
+  assertEqual((uint32_t) 70, stats.getSum());
+  assertEqual((uint16_t) 20, stats.getMin());
+  assertEqual((uint16_t) 50, stats.getMax());
+  assertEqual((uint16_t) 35, stats.getAvg());
+  assertEqual((uint16_t) 0, stats.getCurrent().getCount());
+
+  // Interval 1 drops out.
+  stats.advance();
+  assertEqual((uint32_t) 1, stats.getCount());
+  assertEqual((uint16_t) 20, stats.getMin());
+  assertEqual((uint16_t) 20, stats.getMax());
+
+  // Everything drops out.
+  stats.advance();
+  assertEqual((uint32_t) 0, stats.getCount());
+  assertEqual((uint16_t) 0, stats.getMax());
+}
+
+test(WindowedStatsTest, max_of_newer_interval_replaces_older) {
+  Stats stats;
+  stats.update(10);
+  stats.advance();
+  stats.update(5);
+  stats.update(40); // replaces both older candidates
+  assertEqual((uint16_t) 40, stats.getMax());
+  assertEqual((uint16_t) 5, stats.getMin());
+  stats.advance();
+  stats.advance();
+  assertEqual((uint16_t) 40, stats.getMax());
+  assertEqual((uint16_t) 5, stats.getMin());
+  stats.advance();
+  assertEqual((uint16_t) 0, stats.getMax());
+}
+
+test(WindowedStatsTest, matches_brute_force) {
+  const uint8_t kBuckets = 5;
+  WindowedStats<uint16_t, kBuckets, uint32_t> stats;
+  uint16_t values[kBuckets][4];
+  uint8_t counts[kBuckets] = {0};
+  uint8_t index = 0;
+  uint16_t x = 12345;
+
+  for (uint16_t i = 0; i < 300; i++) {
+    x = x * 25173 + 13849;
+    if (x % 3 == 0) {
+      stats.advance();
+      ace_common::incrementMod(index, kBuckets);
+      counts[index] = 0;
+    } else if (counts[index] < 4) {
+      uint16_t value = x % 1000;
+      values[index][counts[index]++] = value;
+      stats.update(value);
+    }
+
+    uint32_t count = 0;
+    uint16_t minValue = 0xFFFF;
+    uint16_t maxValue = 0;
+    for (uint8_t b = 0; b < kBuckets; b++) {
+      for (uint8_t j = 0; j < counts[b]; j++) {
+        uint16_t value = values[b][j];
+        count++;
+        if (value < minValue) minValue = value;
+        if (value > maxValue) maxValue = value;
+      }
+    }
+    assertEqual(count, stats.getCount());
+    if (count > 0) {
+      assertEqual(minValue, stats.getMin());
+      assertEqual(maxValue, stats.getMax());
+    }
+  }
+}
+
+test(WindowedStatsTest, tick) {
+  Stats stats(1000);
+  stats.tick(5000); // starts the first interval
+  stats.update(10);
+  stats.tick(5999);
+  stats.update(20);
+  assertEqual((uint16_t) 2, stats.getCurrent().getCount());
+
+  stats.tick(6000);
+  assertEqual((uint16_t) 0, stats.getCurrent().getCount());
+  stats.update(30);
+  assertEqual((uint32_t) 3, stats.getCount());
+
+  // Skip 2 intervals, which drops the first one.
+  stats.tick(8500);
+  assertEqual((uint32_t) 1, stats.getCount());
+  assertEqual((uint16_t) 30, stats.getMax());
+
+  // A long pause clears everything.
+  stats.tick(100000);
+  assertEqual((uint32_t) 0, stats.getCount());
+}
+
+test(WindowedStatsTest, reset) {
+  Stats stats;
+  stats.update(10);
+  stats.advance();
+  stats.update(20);
+  stats.reset();
+  assertEqual((uint32_t) 0, stats.getCount());
+  assertEqual((uint16_t) 0, stats.getMax());
+  stats.update(7);
+  assertEqual((uint16_t) 7, stats.getMin());
+  assertEqual((uint16_t) 7, stats.getMax());
+}
+
+test(WindowedStatsTest, float_values) {
+  WindowedStats<float, 2> stats;
+  stats.update(1.5);
+  stats.advance();
+  stats.update(2.5);
+  assertNear(2.0f, stats.getAvg(), 0.0001f);
+  assertNear(2.5f, stats.getMax(), 0.0001f);
+  stats.advance();
+  assertNear(2.5f, stats.getMin(), 0.0001f);
+}
+
+//----------------------------------------------------------------------------
+
+void setup() {
+#ifndef EPOXY_DUINO
+  delay(1000); // wait for stability on some boards to prevent garbage Serial
+#endif
+
+  SERIAL_PORT_MONITOR.begin(115200);
+  while(!SERIAL_PORT_MONITOR); // for the Arduino Leonardo/Micro only
+
+#if defined(EPOXY_DUINO)
+  Serial.setLineModeUnix();
+#endif
+}
+
+void loop() {
+  TestRunner::run();
+}